@@ -540,6 +540,10 @@ QString cTranslator::engText[] =
 	"Refer to device datasheet, please",
 	"Checked items means programmed",
 	"UnChecked items means unprogrammed",
+
+	"Blank check (Erase only if not blank)",
+	"Device is blank",
+	"Detected device: %1 (confidence %2%)",
 	""
 };
 
@@ -479,6 +479,10 @@ enum TR_CONSTS
 	STR_LBLFUSEDLGHLP,
 	STR_FUSEDLGNOTESET,
 	STR_FUSEDLGNOTECLR,
+
+	STR_MSGBLANKCHECK,
+	STR_MSGBLANKOK,
+	STR_MSGIDENTIFIED,
 	STR_ENUM_SIZE
 };
 
@@ -37,7 +37,8 @@
 At17xxx::At17xxx(e2AppWinInfo *wininfo, BusIO *busp)
 	:       E24xx(wininfo, busp, 8, 1)
 {
-	writepage_size = 64;
+	def_writepage_size = 64;
+	writepage_size = def_writepage_size;
 }
 
 int At17xxx::WritePage(long addr, int addr_bytes, uint8_t *buf, int len)
@@ -76,15 +77,7 @@ int At17xxx::WritePage(long addr, int addr_bytes, uint8_t *buf, int len)
 	GetBus()->Stop();
 
 	//Data polling
-	for (j = timeout_loop; j > 0 && GetBus()->Start(eeprom_addr[0] & ~1) < 0; j--)
-		;;
-
-	if (j == 0)
-	{
-		return E2P_TIMEOUT;
-	}
-
-	return OK;
+	return WaitWriteCycle(eeprom_addr[0] & ~1);
 }
 
 int At17xxx::Write(int probe, int type)
@@ -119,14 +112,57 @@ int At17xxx::Write(int probe, int type)
 	if (type & PROG_TYPE)
 	{
 		long j;
+		uint8_t scratch[128];           //max writepage_size
 
 		for (j = 0; j < size; j += writepage_size)
 		{
-			rval = WritePage(j, addr_bytes, GetBufPtr() + j, writepage_size);
+			bool skip = false;
 
-			if (rval != OK)
+			if (GetBus()->GetDiffWrite())
 			{
-				break;
+				if (ReadPage(j, addr_bytes, scratch, writepage_size) != OK)
+				{
+					GetBus()->Stop();
+				}
+				else
+				{
+					skip = (memcmp(scratch, GetBufPtr() + j, writepage_size) == 0);
+				}
+
+				if (skip)
+				{
+					GetBus()->PageSkipped();
+				}
+				else
+				{
+					GetBus()->PageWritten();
+				}
+			}
+
+			if (!skip)
+			{
+				rval = WritePage(j, addr_bytes, GetBufPtr() + j, writepage_size);
+
+				if (rval != OK)
+				{
+					break;
+				}
+
+				if (GetBus()->GetInlineVerify())
+				{
+					rval = ReadPage(j, addr_bytes, scratch, writepage_size);
+
+					if (rval != OK)
+					{
+						break;
+					}
+
+					if (memcmp(scratch, GetBufPtr() + j, writepage_size) != 0)
+					{
+						rval = GetBus()->VerifyFailed(j);
+						break;
+					}
+				}
 			}
 
 			if (GetBus()->WriteProgress(j * 100 / size))
@@ -150,6 +186,21 @@ int At17xxx::Write(int probe, int type)
 }
 
 
+//Lettura sequenziale di len byte con un solo indirizzamento,
+// i dati arrivano LSB first come in ReadPage()
+int At17xxx::ReadSeq(long addr, int addr_bytes, uint8_t *buf, long len, long total)
+{
+	uint8_t index[3];
+	int j;
+
+	for (j = 0; j < addr_bytes; j++)
+	{
+		index[j] = (uint8_t)((addr >> ((addr_bytes - 1 - j) * 8)) & 0xFF);
+	}
+
+	return SequentialRead(eeprom_addr[0] & ~1, index, addr_bytes, buf, len, addr, total, 1);
+}
+
 int At17xxx::ReadPage(long addr, int addr_bytes, uint8_t *buf, int len)
 {
 	int j;
@@ -224,7 +275,6 @@ int At17xxx::Read(int probe, int type)
 
 	GetBus()->ReadStart();
 
-	int readpage_size;
 	int addr_bytes;
 	long size = GetSize();
 
@@ -232,35 +282,23 @@ int At17xxx::Read(int probe, int type)
 	{
 		//512/1024 kbits
 		addr_bytes = 3;
-		readpage_size = 128;
 	}
 	else
 	{
 		//65/128/256 kbits
 		addr_bytes = 2;
-		readpage_size = 64;
 	}
 
 	error = OK;
 
 	if (type & PROG_TYPE)
 	{
+		long readpage_size = GetSeqReadChunk(size, size);
 		long k;
 
-		for (k = 0; k < size; k += readpage_size)
+		for (k = 0; k < size && error == OK; k += readpage_size)
 		{
-			error = ReadPage(k, addr_bytes, GetBufPtr() + k, readpage_size);
-
-			if (error != OK)
-			{
-				break;
-			}
-
-			if (GetBus()->ReadProgress(k * 100 / size))
-			{
-				error = OP_ABORTED;
-				break;
-			}
+			error = ReadSeq(k, addr_bytes, GetBufPtr() + k, readpage_size, size);
 		}
 	}
 
@@ -285,7 +323,6 @@ int At17xxx::Verify(int type)
 		return rval;
 	}
 
-	int readpage_size;
 	int addr_bytes;
 	long size = GetSize();
 
@@ -293,15 +330,14 @@ int At17xxx::Verify(int type)
 	{
 		//512/1024 kbits
 		addr_bytes = 3;
-		readpage_size = 128;
 	}
 	else
 	{
 		//65/128/256 kbits
 		addr_bytes = 2;
-		readpage_size = 64;
 	}
 
+	long readpage_size = GetSeqReadChunk(size, size);
 	unsigned char *localbuf = new unsigned char[readpage_size];
 
 	GetBus()->ReadStart();
@@ -314,7 +350,7 @@ int At17xxx::Verify(int type)
 
 		for (k = 0; k < size; k += readpage_size)
 		{
-			rval = ReadPage(k, addr_bytes, localbuf, readpage_size);
+			rval = ReadSeq(k, addr_bytes, localbuf, readpage_size, size);
 
 			if (rval != OK)
 			{
@@ -330,12 +366,6 @@ int At17xxx::Verify(int type)
 			{
 				rval = 1;
 			}
-
-			if (GetBus()->ReadProgress(k * 100 / size))
-			{
-				rval = OP_ABORTED;
-				break;
-			}
 		}
 	}
 
@@ -40,10 +40,24 @@ class At17xxx : public E24xx
 	int Write(int probe = 1, int type = ALL_TYPE);
 	int Verify(int type = ALL_TYPE);
 
+	bool CanInlineVerify(int type) const
+	{
+		(void)type;
+		return true;
+	}
+
+	//Verify() doesn't build the mismatch map
+	int Repair(int retries)
+	{
+		(void)retries;
+		return NOTSUPPORTED;
+	}
+
   protected:    //--------------------------------------- protected
 
 	int WritePage(long addr, int addr_bytes, uint8_t *buf, int len);
 	int ReadPage(long addr, int addr_bytes, uint8_t *buf, int len);
+	int ReadSeq(long addr, int addr_bytes, uint8_t *buf, long len, long total);
 
   private:              //--------------------------------------- private
 
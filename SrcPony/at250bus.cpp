@@ -146,6 +146,24 @@ int At250Bus::Reset(void)
 	return OK;
 }
 
+// Check for a 25xxx part without touching the array: the write enable
+// latch must follow WREN and WRDI. A missing device reads all 1s or 0s.
+bool At250Bus::ProbeWriteLatch()
+{
+	int st_en, st_dis;
+
+	SendDataByte(WriteEnable);
+	EndCycle();
+	st_en = ReadEEPStatus();
+
+	SendDataByte(WriteDisable);
+	EndCycle();
+	st_dis = ReadEEPStatus();
+
+	qDebug() << "At250Bus::ProbeWriteLatch() " << (hex) << st_en << " - " << st_dis << (dec);
+
+	return (st_en & WenFlag) && !(st_dis & WenFlag) && !(st_en & NotReadyFlag);
+}
 
 long At250Bus::Read(int addr, uint8_t *data, long length, int page_size)
 {
@@ -155,9 +173,25 @@ long At250Bus::Read(int addr, uint8_t *data, long length, int page_size)
 
 	ReadStart();
 
+	if (GetSeqRead() && length > 0)
+	{
+		//un solo comando, l'indirizzo si incrementa da solo
+		SendDataByte(ReadData | (((addr >> 8) & 1) << 3));
+		SendDataByte(addr);
+
+		WaitUsec(shot_delay);
+	}
+
 	for (len = 0; len < length; len++)
 	{
-		*data++ = (uint8_t)ReadEEPByte(addr++);
+		if (GetSeqRead())
+		{
+			*data++ = (uint8_t)RecDataByte();
+		}
+		else
+		{
+			*data++ = (uint8_t)ReadEEPByte(addr++);
+		}
 
 		if ((len % 10) == 0)
 		{
@@ -168,6 +202,11 @@ long At250Bus::Read(int addr, uint8_t *data, long length, int page_size)
 		}
 	}
 
+	if (GetSeqRead())
+	{
+		EndCycle();
+	}
+
 	ReadEnd();
 
 	qDebug() << "At250Bus::Read() = " << len;
@@ -188,19 +227,39 @@ long At250Bus::Write(int addr, uint8_t const *data, long length, int page_size)
 		return 0;
 	}
 
-	for (len = 0; len < length; len++)
+	if (page_size < 1)
 	{
+		page_size = 1;
+	}
+
+	long count = 0;
+
+	for (len = 0; len < length; len += page_size)
+	{
+		int j;
+		int n = (length - len < page_size) ? (int)(length - len) : page_size;
+
 		SendDataByte(WriteEnable);
 		EndCycle();
 
-		WriteEEPByte(addr++, *data++);
+		//Page write: A8 nel comando, una sola attesa per pagina
+		SendDataByte(WriteData | (((addr >> 8) & 1) << 3));
+		SendDataByte(addr);
+
+		for (j = 0; j < n; j++)
+		{
+			SendDataByte(*data++);
+		}
+
+		EndCycle();
+		addr += n;
 
 		if (!WaitEndOfWrite())
 		{
 			return 0;        //Must return 0, because > 0 (and != length) means "Abort by user"
 		}
 
-		if ((len & 1))
+		if ((++count & 1))
 		{
 			if (WriteProgress(len * 100 / length))
 			{
@@ -209,6 +268,11 @@ long At250Bus::Write(int addr, uint8_t const *data, long length, int page_size)
 		}
 	}
 
+	if (len > length)
+	{
+		len = length;
+	}
+
 	WriteEnd();
 
 	return len;
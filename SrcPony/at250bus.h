@@ -40,6 +40,8 @@ class At250Bus : public SPIBus
 
 	int Reset();
 
+	bool ProbeWriteLatch();
+
   protected:             //------------------------------- protected
 
 	virtual int ReadEEPByte(int addr);
@@ -30,8 +30,6 @@
 
 #include <QDebug>
 
-#include "e2cmdw.h"
-
 #ifndef __linux__
 #  ifdef        __BORLANDC__
 #    define     __inline__
@@ -43,7 +41,8 @@
 
 // Costruttore
 At250BigBus::At250BigBus(BusInterface *ptr)
-	: At250Bus(ptr)
+	: At250Bus(ptr),
+	  addr_bytes(2)
 {
 	qDebug() << "At250BigBus::At250BigBus(" << (hex) << ptr << (dec) <<  ")";
 }
@@ -56,8 +55,7 @@ long At250BigBus::Read(int addr, uint8_t *data, long length, int page_size)
 	long len;
 
 	SendDataByte(ReadData);
-	SendDataByte((addr >> 8) & 0xFF);       //MSB
-	SendDataByte(addr       & 0xFF);        //LSB
+	SendAddress(addr);
 
 	WaitUsec(shot_delay);
 
@@ -83,14 +81,46 @@ long At250BigBus::Read(int addr, uint8_t *data, long length, int page_size)
 }
 
 
+//Invia l'indirizzo, MSB per primo
+void At250BigBus::SendAddress(int addr)
+{
+	int k;
+
+	for (k = addr_bytes - 1; k >= 0; k--)
+	{
+		SendDataByte((addr >> (k * 8)) & 0xFF);
+	}
+}
+
+//Scrittura differenziale: confronta la pagina senza scriverla
+bool At250BigBus::PageMatches(int addr, uint8_t const *data, int len)
+{
+	int j;
+	bool match = true;
+
+	SendDataByte(ReadData);
+	SendAddress(addr);
+
+	WaitUsec(shot_delay);
+
+	for (j = 0; j < len && match; j++)
+	{
+		match = (RecDataByte() == data[j]);
+	}
+
+	EndCycle();
+
+	return match;
+}
+
 long At250BigBus::Write(int addr, uint8_t const *data, long length, int page_size)
 {
 	long len;
 
 	WriteStart();
 
-	int writepage_size = E2Profile::GetSPIPageWrite();
-//	E2Profile::SetSPIPageWrite(writepage_size);
+	//page_size dal dispositivo, 16 per compatibilita`
+	int writepage_size = (page_size > 0) ? page_size : 16;
 
 	WriteEEPStatus(0);
 
@@ -103,25 +133,49 @@ long At250BigBus::Write(int addr, uint8_t const *data, long length, int page_siz
 	long count = 0;
 	for (len = 0; len < length; len += writepage_size, addr += writepage_size)
 	{
-		SendDataByte(WriteEnable);
-		EndCycle();
+		bool skip = false;
 
-		SendDataByte(WriteData);
-		SendDataByte((addr >> 8) & 0xFF);       //MSB
-		SendDataByte(addr       & 0xFF);        //LSB
+		if (GetDiffWrite())
+		{
+			skip = PageMatches(addr, data, writepage_size);
 
-		int j;
+			if (skip)
+			{
+				PageSkipped();
+				data += writepage_size;
+			}
+			else
+			{
+				PageWritten();
+			}
+		}
 
-		for (j = 0; j < writepage_size; j++)
+		if (!skip)
 		{
-			SendDataByte(*data++);
-		}
+			SendDataByte(WriteEnable);
+			EndCycle();
 
-		EndCycle();
+			SendDataByte(WriteData);
+			SendAddress(addr);
 
-		if (!WaitEndOfWrite())
-		{
-			return 0;        //Must return 0, because > 0 (and != length) means "Abort by user"
+			int j;
+
+			for (j = 0; j < writepage_size; j++)
+			{
+				SendDataByte(*data++);
+			}
+
+			EndCycle();
+
+			if (!WaitEndOfWrite())
+			{
+				return 0;        //Must return 0, because > 0 (and != length) means "Abort by user"
+			}
+
+			if (GetInlineVerify() && !PageMatches(addr, data - writepage_size, writepage_size))
+			{
+				return VerifyFailed(addr);
+			}
 		}
 
 		if ((++count & 1))
@@ -39,11 +39,24 @@ class At250BigBus: public At250Bus
 
 	//      int Reset();
 
+	void SetAddressBytes(int n)
+	{
+		if (n >= 1 && n <= 4)
+		{
+			addr_bytes = n;
+		}
+	}
+
   protected:             //------------------------------- protected
 
 	//      int ReadEEPByte(int addr);
 	//      void WriteEEPByte(int addr, int data);
 
+	void SendAddress(int addr);
+	bool PageMatches(int addr, uint8_t const *data, int len);
+
+	int addr_bytes;                 //byte di indirizzo dopo il comando
+
   private:               //------------------------------- private
 
 	//Programming commands
@@ -28,12 +28,14 @@
 #include "at250xx.h"            // Header file
 #include "errcode.h"
 #include "eeptypes.h"
+#include "e2awinfo.h"
 
 #include <QDebug>
 
 //=====>>> Costruttore <<<======
 At250xx::At250xx(e2AppWinInfo *wininfo, BusIO *busp)
-	:       Device(wininfo, busp, 1 /*BANK_SIZE*/)
+	:       Device(wininfo, busp, 1 /*BANK_SIZE*/),
+			writepage_size(1)
 {
 }
 
@@ -42,6 +44,14 @@ At250xx::~At250xx()
 {
 }
 
+//Dimensione pagina dalla tabella dei dispositivi (1 --> un byte alla volta)
+void At250xx::SetupPageGeometry()
+{
+	int page_size = GetEEPTypeWPageSize(GetAWInfo()->GetEEPId());
+
+	writepage_size = (page_size > 0) ? page_size : 1;
+}
+
 // determina il numero di banchi (dimensione) dell'eeprom
 //---
 int At250xx::Probe(int probe_size)
@@ -61,6 +71,8 @@ int At250xx::Read(int probe, int type)
 {
 	qDebug() << "At250xx::Read(" << probe << ")";
 
+	SetupPageGeometry();
+
 	if (probe || GetNoOfBank() == 0)
 	{
 		Probe();
@@ -92,6 +104,8 @@ int At250xx::Read(int probe, int type)
 
 int At250xx::Write(int probe, int type)
 {
+	SetupPageGeometry();
+
 	if (probe || GetNoOfBank() == 0)
 	{
 		Probe();
@@ -103,7 +117,7 @@ int At250xx::Write(int probe, int type)
 
 	if (type & PROG_TYPE)
 	{
-		rv = GetBus()->Write(0, GetBufPtr(), size);
+		rv = GetBus()->Write(0, GetBufPtr(), size, writepage_size);
 
 		if (rv != size)
 		{
@@ -119,6 +133,8 @@ int At250xx::Write(int probe, int type)
 
 int At250xx::Verify(int type)
 {
+	SetupPageGeometry();
+
 	if (GetNoOfBank() == 0)
 	{
 		return BADPARAM;
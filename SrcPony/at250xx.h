@@ -52,6 +52,10 @@ class At250xx : public Device
 		return static_cast<At250Bus *>(Device::GetBus());
 	}
 
+	virtual void SetupPageGeometry();
+
+	int writepage_size;                             //se > 1 scrive una pagina alla volta
+
   private:              //--------------------------------------- private
 
 };
@@ -28,6 +28,8 @@
 #include "at25xxx.h"            // Header file
 #include "errcode.h"
 #include "eeptypes.h"
+#include "e2awinfo.h"
+#include "e2profil.h"
 
 //=====>>> Costruttore <<<======
 At25xxx::At25xxx(e2AppWinInfo *wininfo, BusIO *busp)
@@ -40,3 +42,35 @@ At25xxx::~At25xxx()
 {
 }
 
+//Il latch WEL dice solo la famiglia, non la dimensione
+int At25xxx::Identify(long &type, int &confidence)
+{
+	if (GetBus()->ProbeWriteLatch())
+	{
+		long id = GetAWInfo()->GetEEPId();
+
+		type = (GetE2PPriType(id) == E25XXX) ? id : E25080;
+		confidence = 40;
+		return OK;
+	}
+
+	confidence = 0;
+	return DEVICE_UNKNOWN;
+}
+
+//La dimensione pagina nel profilo e` solo un override esplicito
+void At25xxx::SetupPageGeometry()
+{
+	long type = GetAWInfo()->GetEEPId();
+	int page_size = E2Profile::GetSPIPageWrite();
+
+	if (page_size <= 0)
+	{
+		page_size = GetEEPTypeWPageSize(type);
+	}
+
+	writepage_size = (page_size > 0) ? page_size : 16;
+
+	int addr_bytes = GetEEPTypeAddrBytes(type);
+	GetBus()->SetAddressBytes((addr_bytes > 0) ? addr_bytes : 2);
+}
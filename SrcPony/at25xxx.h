@@ -40,6 +40,14 @@ class At25xxx : public At250xx
 	At25xxx(e2AppWinInfo *wininfo = 0, BusIO *busp = 0);
 	virtual ~At25xxx();
 
+	bool CanInlineVerify(int type) const
+	{
+		(void)type;
+		return true;
+	}
+
+	int Identify(long &type, int &confidence);
+
   protected:    //--------------------------------------- protected
 
 	At250BigBus *GetBus()
@@ -47,6 +55,8 @@ class At25xxx : public At250xx
 		return static_cast<At250BigBus *>(Device::GetBus());
 	}
 
+	void SetupPageGeometry();
+
   private:              //--------------------------------------- private
 
 };
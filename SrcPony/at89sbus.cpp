@@ -601,6 +601,46 @@ int At89sBus::WaitReadyAfterWrite(int type, long addr, int data, long timeout)
 	return rval;
 }
 
+//Inline verify: rilegge una pagina appena scritta (type 0 prog, 1 data),
+// restituisce l'indirizzo del primo byte diverso oppure -1
+long At89sBus::ComparePage(int type, long addr, uint8_t const *data, long page_size)
+{
+	uint8_t buf[256];
+	long k;
+
+	if (page_size > (long)sizeof(buf))
+	{
+		for (k = 0; k < page_size; k++)
+		{
+			if ((type ? ReadDataByte(addr + k) : ReadProgByte(addr + k)) != data[k])
+			{
+				return addr + k;
+			}
+		}
+
+		return -1;
+	}
+
+	if (type)
+	{
+		ReadDataPage(addr, buf, page_size);
+	}
+	else
+	{
+		ReadProgPage(addr, buf, page_size);
+	}
+
+	for (k = 0; k < page_size; k++)
+	{
+		if (buf[k] != data[k])
+		{
+			return addr + k;
+		}
+	}
+
+	return -1;
+}
+
 bool At89sBus::CheckBlankPage(uint8_t const *data, long length)
 {
 	bool blank_page = true;
@@ -635,6 +675,16 @@ long At89sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 					return E2ERR_WRITEFAILED;
 				}
 
+				if (GetInlineVerify())
+				{
+					long bad = ComparePage(1, addr, data, page_size);
+
+					if (bad >= 0)
+					{
+						return VerifyFailed(bad);
+					}
+				}
+
 				if (WriteProgress(len * 100 / length))
 				{
 					break;
@@ -663,6 +713,11 @@ long At89sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 						{
 							return E2ERR_WRITEFAILED;
 						}
+
+						if (GetInlineVerify() && ReadDataByte(addr) != *data)
+						{
+							return VerifyFailed(addr);
+						}
 					}
 				}
 
@@ -676,6 +731,15 @@ long At89sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 	else
 	{
 		//Prog
+		//Inline verify checks blank pages too, but only up to the
+		// last one to program like Device::VerifyProg() does
+		long last_used = length;
+
+		while (last_used > 0 && data[last_used - 1] == 0xFF)
+		{
+			last_used--;
+		}
+
 		if (page_size > 1)
 		{
 			for (addr = 0, len = 0; len < length; len += page_size, addr += page_size, data += page_size)
@@ -687,6 +751,16 @@ long At89sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 						return E2ERR_WRITEFAILED;
 					}
 
+				if (GetInlineVerify() && len < last_used)
+				{
+					long bad = ComparePage(0, addr, data, page_size);
+
+					if (bad >= 0)
+					{
+						return VerifyFailed(bad);
+					}
+				}
+
 				if (WriteProgress(len * 100 / length))
 				{
 					break;
@@ -715,6 +789,11 @@ long At89sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 						{
 							return E2ERR_WRITEFAILED;
 						}
+
+						if (GetInlineVerify() && ReadProgByte(addr) != *data)
+						{
+							return VerifyFailed(addr);
+						}
 					}
 				}
 
@@ -98,6 +98,7 @@ class At89sBus : public SPIBus
 
 	int WaitReadyAfterWrite(int type, long addr, int data, long timeout = 5000);
 	bool CheckBlankPage(uint8_t const *data, long length);
+	long ComparePage(int type, long addr, uint8_t const *data, long page_size);
 
   private:               //------------------------------- private
 
@@ -59,7 +59,15 @@ int At89sxx::SecurityWrite(uint32_t bits)
 
 	if (rv > 0)
 	{
-		rv = GetBus()->WriteLockBits(bits, GetAWInfo()->GetEEPId());
+		uint32_t cur = 0;
+		int read_rv = GetBus()->ReadLockBits(cur, GetAWInfo()->GetEEPId());
+
+		rv = OK;
+
+		if (ConfigChanged("Lock", read_rv, cur, bits))
+		{
+			rv = GetBus()->WriteLockBits(bits, GetAWInfo()->GetEEPId());
+		}
 	}
 
 	return rv;
@@ -83,7 +91,15 @@ int At89sxx::FusesWrite(uint32_t bits)
 
 	if (rv > 0)
 	{
-		rv = GetBus()->WriteFuseBits(bits, GetAWInfo()->GetEEPId());
+		uint32_t cur = 0;
+		int read_rv = GetBus()->ReadFuseBits(cur, GetAWInfo()->GetEEPId());
+
+		rv = OK;
+
+		if (ConfigChanged("Fuse", read_rv, cur, bits))
+		{
+			rv = GetBus()->WriteFuseBits(bits, GetAWInfo()->GetEEPId());
+		}
 	}
 
 	return rv;
@@ -138,6 +154,15 @@ int At89sxx::QueryType(long &type)
 	return rv;
 }
 
+int At89sxx::Identify(long &type, int &confidence)
+{
+	int rv = QueryType(type);
+
+	confidence = (rv == OK) ? 100 : 0;
+
+	return rv;
+}
+
 int At89sxx::Probe(int probe_size)
 {
 	int rv = OK;
@@ -157,7 +182,7 @@ int At89sxx::Probe(int probe_size)
 		case AT89S8253:
 		{
 			long type;
-			rv = QueryType(type);
+			rv = QueryTypeCached(type);
 			int subtype = GetE2PSubType(type);
 
 			if (rv == OK)
@@ -252,13 +277,27 @@ int At89sxx::Write(int probe, int type)
 
 			if (rv > 0 && (type & CONFIG_TYPE))
 			{
+				//read both first, then write only what changes
+				long id = GetAWInfo()->GetEEPId();
+				uint32_t cur_fuse = 0, cur_lock = 0;
+				int fret = GetBus()->ReadFuseBits(cur_fuse, id);
+				int lret = GetBus()->ReadLockBits(cur_lock, id);
+
 				//write the fuses
 				uint32_t f = GetAWInfo()->GetFuseBits();
-				GetBus()->WriteFuseBits(f, GetAWInfo()->GetEEPId());
+
+				if (ConfigChanged("Fuse", fret, cur_fuse, f))
+				{
+					GetBus()->WriteFuseBits(f, id);
+				}
 
 				//write the locks
 				f = GetAWInfo()->GetLockBits();
-				GetBus()->WriteLockBits(f,  GetAWInfo()->GetEEPId());
+
+				if (ConfigChanged("Lock", lret, cur_lock, f))
+				{
+					GetBus()->WriteLockBits(f, id);
+				}
 			}
 		}
 	}
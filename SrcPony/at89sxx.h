@@ -45,6 +45,12 @@ class At89sxx : public Device
 	int Write(int probe = 1, int type = ALL_TYPE);
 	int Verify(int type = ALL_TYPE);
 
+	bool CanInlineVerify(int type) const
+	{
+		(void)type;
+		return true;
+	}
+
 	//      int Erase(int probe = 1, int type = ALL_TYPE);
 
 	int SecurityRead(uint32_t &bits);
@@ -53,6 +59,8 @@ class At89sxx : public Device
 	int FusesRead(uint32_t &bits);
 	int FusesWrite(uint32_t bits);
 
+	int Identify(long &type, int &confidence);
+
 	At89sBus *GetBus()
 	{
 		return static_cast<At89sBus *>(Device::GetBus());
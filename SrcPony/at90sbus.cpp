@@ -30,12 +30,18 @@
 #include "eeptypes.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
 
 #include "e2cmdw.h"
 
 //Pay attention that Intel Hex format is Little Endian
 #undef  _BIG_ENDIAN_
 
+//Datasheet tWD_FLASH and tWD_EEPROM (usec): the longest of the AVR parts
+// without Poll RDY/BSY (ATmega8/16/32/64/128)
+#define TWD_FLASH_MIN   4500
+#define TWD_EEPROM_MIN  9000
+
 // Constructor
 At90sBus::At90sBus(BusInterface *ptr)
 	: SPIBus(ptr),
@@ -48,6 +54,9 @@ At90sBus::At90sBus(BusInterface *ptr)
 	  WriteProgPageMem(0x4C),
 	  ReadEEPMem0(0xA0), ReadEEPMem1(0),
 	  WriteEEPMem0(0xC0), WriteEEPMem1(0),
+	  LoadEEPPage0(0xC1), WriteEEPPage0(0xC2),
+	  PollRdyBsy0(0xF0),
+	  LoadExtAddr0(0x4D),
 	  ReadDevCode0(0x30), ReadDevCode1(0),
 	  ReadLock0(0x58), ReadLock1(0),
 	  WriteLock0(0xAC), WriteLock1(0xE0),
@@ -60,13 +69,17 @@ At90sBus::At90sBus(BusInterface *ptr)
 	  ReadCalib0(0x38), ReadCalib1(0),
 	  p1_a(0x80), p2_a(0x7F), pflash_a(0x7F),
 	  p1_b(0x00), p2_b(0xFF), pflash_b(0xFF),
-	  old1200mode(false)
+	  old1200mode(false),
+	  ext_addr(0),
+	  enable_rdybsy_polling(false)
 {
 	qDebug() << "At90sBus::At90sBus()";
 
 	//With this values the AVR can be programmed even at low voltage (3.2V)
 	twd_erase = 30;
 	twd_prog = 10;
+
+	twr_learned[0] = twr_learned[1] = 0;
 }
 
 //limit EEPROM size to 64K max
@@ -115,6 +128,45 @@ int At90sBus::ReadProgByte(long addr)
 	return RecDataByte();
 }
 
+//Legge entrambi i byte di una word della flash, uno dopo l'altro
+void At90sBus::ReadProgWord(long waddr, uint8_t *data)
+{
+	SendDataByte(ReadProgMemL0);
+	SendDataByte(ReadProgMemL1 | ((waddr >> 8) & 0xFF));
+	SendDataByte(waddr);
+	int lo = RecDataByte();
+
+	SendDataByte(ReadProgMemH0);
+	SendDataByte(ReadProgMemH1 | ((waddr >> 8) & 0xFF));
+	SendDataByte(waddr);
+	int hi = RecDataByte();
+
+#ifdef  _BIG_ENDIAN_
+	data[0] = (uint8_t)hi;
+	data[1] = (uint8_t)lo;
+#else
+	data[0] = (uint8_t)lo;
+	data[1] = (uint8_t)hi;
+#endif
+}
+
+//Flash oltre le 64K word (ATmega2560/2561): il comando e` inviato
+// solo quando cambia, quindi mai sui dispositivi piu` piccoli
+void At90sBus::LoadExtAddress(long waddr)
+{
+	int ext = (int)((waddr >> 16) & 0xFF);
+
+	if (ext != ext_addr)
+	{
+		SendDataByte(LoadExtAddr0);
+		SendDataByte(0);
+		SendDataByte(ext);
+		SendDataByte(0);
+
+		ext_addr = ext;
+	}
+}
+
 void At90sBus::WriteProgByte(long addr, int data)
 {
 	SetLastProgrammedAddress(addr);
@@ -150,6 +202,10 @@ int At90sBus::Reset()
 	qDebug() << "At90sBus::Reset() I";
 
 	RefreshParameters();
+	ext_addr = 0;           //reset clears the extended address
+
+	//the chip may have been replaced: forget the times measured on the old one
+	twr_learned[0] = twr_learned[1] = 0;
 
 	if (old1200mode)
 	{
@@ -744,6 +800,9 @@ long At90sBus::Read(int addr, uint8_t *data, long length, int page_size)
 	//      code[1] = ReadDeviceCode(1);
 	//      code[2] = ReadDeviceCode(2);
 
+	//progress and abort are checked once per page, not per byte
+	long chunk = (page_size > 1) ? page_size : 256;
+
 	if (addr)
 	{
 		//EEprom
@@ -753,7 +812,7 @@ long At90sBus::Read(int addr, uint8_t *data, long length, int page_size)
 		{
 			*data++ = (uint8_t)ReadEEPByte(addr++);
 
-			if (ReadProgress(len * 100 / length))
+			if ((len % chunk) == 0 && ReadProgress(len * 100 / length))
 			{
 				break;
 			}
@@ -761,19 +820,27 @@ long At90sBus::Read(int addr, uint8_t *data, long length, int page_size)
 	}
 	else
 	{
-		//Flash Eprom
-		addr = 0;
-
-		for (len = 0; len < length; len++)
+		//Flash Eprom, a word (low and high byte) at a time
+		for (len = 0; len < length; )
 		{
-			*data++ = (uint8_t)ReadProgByte(addr++);
-
-			if (ReadProgress(len * 100 / length))
+			if ((len % chunk) == 0 && ReadProgress(len * 100 / length))
 			{
 				break;
 			}
-		}
 
+			LoadExtAddress(len >> 1);
+
+			if ((len & 1) == 0 && len + 1 < length)
+			{
+				ReadProgWord(len >> 1, data + len);
+				len += 2;
+			}
+			else
+			{
+				data[len] = (uint8_t)ReadProgByte(len);
+				len++;
+			}
+		}
 	}
 
 	ReadEnd();
@@ -792,58 +859,52 @@ int At90sBus::WaitReadyAfterWrite(int type, long addr, int data, long timeout)
 	}
 	else
 	{
+		bool nopoll;
+
 		if (type)
 		{
 			//EEprom
-			if (data == p1_a || data == p2_a ||
-					data == p1_b || data == p2_b)
-			{
-				rval = OK;
-				WaitMsec(twd_prog);
-			}
-			else
-			{
-				rval = E2P_TIMEOUT;
-
-				int k;
-
-				for (k = 0; k < timeout; k++)
-				{
-					int val = ReadEEPByte(addr);
-
-					if (val == data)
-					{
-						rval = OK;
-						break;
-					}
-				}
-			}
-
+			nopoll = (data == p1_a || data == p2_a ||
+					  data == p1_b || data == p2_b);
 		}
 		else
 		{
 			//Flash
-			if (data == pflash_a ||
-					data == pflash_b)
+			nopoll = (data == pflash_a || data == pflash_b);
+		}
+
+		if (nopoll)
+		{
+			//Data polling doesn't work with these values: use RDY/BSY
+			// if available, the delay learned on the other bytes otherwise
+			if (enable_rdybsy_polling)
 			{
-				rval = OK;
-				WaitMsec(twd_prog);
+				rval = WaitRdyBsy(timeout);
 			}
 			else
 			{
-				rval = E2P_TIMEOUT;
+				rval = OK;
+				WaitLearnedDelay(type);
+			}
+		}
+		else
+		{
+			QElapsedTimer timer;
+			timer.start();
 
-				int k;
+			rval = E2P_TIMEOUT;
 
-				for (k = 0; k < timeout; k++)
-				{
-					int val = ReadProgByte(addr);
+			int k;
 
-					if (val == data)
-					{
-						rval = OK;
-						break;
-					}
+			for (k = 0; k < timeout; k++)
+			{
+				int val = type ? ReadEEPByte(addr) : ReadProgByte(addr);
+
+				if (val == data)
+				{
+					rval = OK;
+					LearnDelay(type, (long)(timer.nsecsElapsed() / 1000));
+					break;
 				}
 			}
 		}
@@ -852,6 +913,41 @@ int At90sBus::WaitReadyAfterWrite(int type, long addr, int data, long timeout)
 	return rval;
 }
 
+//Si tiene il tempo piu` lungo misurato sul chip presente dall'ultimo Reset()
+void At90sBus::LearnDelay(int type, long usec)
+{
+	type = type ? 1 : 0;
+
+	if (usec > twr_learned[type])
+	{
+		twr_learned[type] = usec;
+	}
+}
+
+//Learned delay plus 25% margin, never shorter than the datasheet tWD
+// and never longer than the fixed delay. Until a byte of this chip has
+// been polled the fixed delay is used.
+void At90sBus::WaitLearnedDelay(int type)
+{
+	long learned = twr_learned[type ? 1 : 0];
+	long usec = learned + learned / 4;
+	long twd_min = type ? TWD_EEPROM_MIN : TWD_FLASH_MIN;
+
+	if (usec < twd_min)
+	{
+		usec = twd_min;
+	}
+
+	if (learned <= 0 || usec > twd_prog * 1000L)
+	{
+		WaitMsec(twd_prog);
+	}
+	else
+	{
+		WaitUsec(usec);
+	}
+}
+
 //11/09/99
 int At90sBus::Erase(int type)
 {
@@ -863,12 +959,12 @@ int At90sBus::Erase(int type)
 	SendDataByte(0);
 	SendDataByte(0);
 
-	WaitMsec(twd_erase);
+	WaitEraseCycle();
 	Reset();
 
 	/** Needed by ATtiny12 **/
 	WriteProgByte(0, 0xFF);
-	WaitMsec(twd_prog);
+	WaitReadyAfterWrite(0, 0, 0xFF);
 
 	//Erase command
 	SendDataByte(ChipErase0);
@@ -876,7 +972,7 @@ int At90sBus::Erase(int type)
 	SendDataByte(0);
 	SendDataByte(0);
 
-	WaitMsec(twd_erase);
+	WaitEraseCycle();
 	Reset();
 	/****/
 
@@ -891,7 +987,49 @@ long At90sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 
 	WriteStart();
 
-	if (addr)
+	if (addr && page_size > 1)
+	{
+		//EEprom with page write (ATmega/ATtiny): one write cycle per page
+		for (addr = 0, len = 0; len < length; addr += page_size, data += page_size, len += page_size)
+		{
+			long n = (length - len < page_size) ? length - len : page_size;
+			long k;
+
+			//program only pages that really need to be programmed
+			for (k = 0; k < n && ReadEEPByte(addr + k) == data[k]; k++)
+				;
+
+			if (k < n)
+			{
+				if (WriteEEPPage(addr, data, n) != OK)
+				{
+					return E2ERR_WRITEFAILED;
+				}
+
+				if (GetInlineVerify())
+				{
+					for (k = 0; k < n; k++)
+					{
+						if (ReadEEPByte(addr + k) != data[k])
+						{
+							return VerifyFailed(addr + k);
+						}
+					}
+				}
+			}
+
+			if (WriteProgress(len * 100 / length))
+			{
+				break;
+			}
+		}
+
+		if (len > length)
+		{
+			len = length;
+		}
+	}
+	else if (addr)
 	{
 		//EEprom
 		for (addr = 0, len = 0; len < length; addr++, data++, len++)
@@ -910,6 +1048,11 @@ long At90sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 				{
 					return E2ERR_WRITEFAILED;
 				}
+
+				if (GetInlineVerify() && ReadEEPByte(addr) != *data)
+				{
+					return VerifyFailed(addr);
+				}
 			}
 
 			if (WriteProgress(len * 100 / length))
@@ -921,6 +1064,15 @@ long At90sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 	else
 	{
 		//Flash Eprom
+		//Inline verify checks blank locations too, but only up to the
+		// last one to program like Device::VerifyProg() does
+		long last_used = length;
+
+		while (last_used > 0 && data[last_used - 1] == 0xFF)
+		{
+			last_used--;
+		}
+
 		if (page_size > 1)
 		{
 			//Flash Eprom with page write
@@ -933,6 +1085,16 @@ long At90sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 						return E2ERR_WRITEFAILED;
 					}
 
+				if (GetInlineVerify() && len < last_used)
+				{
+					long bad = CompareProgPage(addr, data, page_size);
+
+					if (bad >= 0)
+					{
+						return VerifyFailed(bad);
+					}
+				}
+
 				if (WriteProgress(len * 100 / length))
 				{
 					break;
@@ -956,6 +1118,11 @@ long At90sBus::Write(int addr, uint8_t const *data, long length, int page_size)
 					}
 				}
 
+				if (GetInlineVerify() && len < last_used && ReadProgByte(addr) != *data)
+				{
+					return VerifyFailed(addr);
+				}
+
 				if (WriteProgress(len * 100 / length))
 				{
 					break;
@@ -985,6 +1152,26 @@ void At90sBus::SetFlashPagePolling(bool val)
 	enable_flashpage_polling = val;
 }
 
+//Chip erase: poll RDY/BSY up to the fixed erase delay where available
+void At90sBus::WaitEraseCycle()
+{
+	if (enable_rdybsy_polling)
+	{
+		QElapsedTimer timer;
+		timer.start();
+
+		WaitUsec(100);
+
+		while (WaitRdyBsy(1) != OK && !timer.hasExpired(twd_erase))
+		{
+		}
+	}
+	else
+	{
+		WaitMsec(twd_erase);
+	}
+}
+
 int At90sBus::WriteProgPage(long addr, uint8_t const *data, long page_size, long timeout)
 {
 	long k;
@@ -1009,6 +1196,8 @@ int At90sBus::WriteProgPage(long addr, uint8_t const *data, long page_size, long
 		WriteProgByte(k, *data);
 	}
 
+	LoadExtAddress(addr >> 1);
+
 	SendDataByte(WriteProgPageMem);
 	SendDataByte(addr >> 9);                //send word address
 	SendDataByte(addr >> 1);
@@ -1039,6 +1228,72 @@ int At90sBus::WriteProgPage(long addr, uint8_t const *data, long page_size, long
 	return okflag ? OK : E2P_TIMEOUT;
 }
 
+//EEPROM page mode: carica il buffer della pagina un byte alla volta
+// e lo scrive con un solo ciclo, poi attende con il polling RDY/BSY
+int At90sBus::WriteEEPPage(long addr, uint8_t const *data, long page_size, long timeout)
+{
+	long k;
+
+	if (page_size <= 0 || data == NULL)
+	{
+		return BADPARAM;
+	}
+
+	for (k = 0; k < page_size; k++)
+	{
+		SendDataByte(LoadEEPPage0);
+		SendDataByte(0);
+		SendDataByte(k);                //offset within the page
+		SendDataByte(data[k]);
+	}
+
+	SendDataByte(WriteEEPPage0);
+	SendDataByte((addr & 0xFFFF) >> 8);
+	SendDataByte(addr);
+	SendDataByte(0);
+
+	WaitUsec(100);
+
+	return WaitRdyBsy(timeout);
+}
+
+//Poll RDY/BSY: il bit 0 resta a 1 finche` la scrittura e` in corso
+int At90sBus::WaitRdyBsy(long timeout)
+{
+	long k;
+
+	for (k = timeout; k > 0; k--)
+	{
+		SendDataByte(PollRdyBsy0);
+		SendDataByte(0);
+		SendDataByte(0);
+
+		if ((RecDataByte() & 1) == 0)
+		{
+			return OK;
+		}
+	}
+
+	return E2P_TIMEOUT;
+}
+
+//Inline verify: rilegge dalla flash, restituisce l'indirizzo
+// del primo byte diverso oppure -1 se la pagina corrisponde
+long At90sBus::CompareProgPage(long addr, uint8_t const *data, long length)
+{
+	long k;
+
+	for (k = 0; k < length; k++)
+	{
+		if (ReadProgByte(addr + k) != data[k])
+		{
+			return addr + k;
+		}
+	}
+
+	return -1;
+}
+
 bool At90sBus::CheckBlankPage(uint8_t const *data, long length)
 {
 	bool blank_page = true;
@@ -54,6 +54,10 @@ class At90sBus : public SPIBus
 	{
 		old1200mode = val;
 	}
+	void SetRdyBsyPolling(bool val)
+	{
+		enable_rdybsy_polling = val;
+	}
 
   protected:             //------------------------------- protected
 
@@ -67,6 +71,9 @@ class At90sBus : public SPIBus
 	const uint8_t WriteProgPageMem;
 	const uint8_t ReadEEPMem0, ReadEEPMem1;
 	const uint8_t WriteEEPMem0, WriteEEPMem1;
+	const uint8_t LoadEEPPage0, WriteEEPPage0;
+	const uint8_t PollRdyBsy0;
+	const uint8_t LoadExtAddr0;
 	const uint8_t ReadDevCode0, ReadDevCode1;
 	const uint8_t ReadLock0, ReadLock1;
 	const uint8_t WriteLock0, WriteLock1;
@@ -81,11 +88,19 @@ class At90sBus : public SPIBus
 	int ReadEEPByte(long addr);
 	void WriteEEPByte(long addr, int data);
 	int ReadProgByte(long addr);
+	void ReadProgWord(long waddr, uint8_t *data);
+	void LoadExtAddress(long waddr);
 	void WriteProgByte(long addr, int data);
 	int WriteProgPage(long addr, uint8_t const *data, long page_size, long timeout = 10000);
+	int WriteEEPPage(long addr, uint8_t const *data, long page_size, long timeout = 10000);
+	int WaitRdyBsy(long timeout);
+	void WaitEraseCycle();
 
 	int WaitReadyAfterWrite(int type, long addr, int data, long timeout = 10000);
+	void LearnDelay(int type, long usec);
+	void WaitLearnedDelay(int type);
 	bool CheckBlankPage(uint8_t const *data, long length);
+	long CompareProgPage(long addr, uint8_t const *data, long length);
 	void RefreshParameters();
 
 	//Polling codes
@@ -101,6 +116,10 @@ class At90sBus : public SPIBus
   private:               //------------------------------- private
 
 	bool enable_flashpage_polling;
+	int ext_addr;                   //current Load Extended Address byte (> 64K words)
+	bool enable_rdybsy_polling;     //Poll RDY/BSY instruction available
+
+	long twr_learned[2];            //longest polled write cycle since Reset() (usec, 0 = none)
 };
 
 #endif
@@ -31,6 +31,7 @@
 #include "eeptypes.h"
 
 #include <QDebug>
+#include <QHash>
 
 #include "e2awinfo.h"
 #include "e2cmdw.h"
@@ -67,7 +68,12 @@ int At90sxx::SecurityWrite(uint32_t bits)
 
 	if (rv > 0)     //Try to write even with AutoXXX device setted
 	{
-		rv = GetBus()->WriteLockBits(bits, GetAWInfo()->GetEEPId());
+		rv = OK;
+
+		if (ConfigChanged("Lock", OK, GetBus()->ReadLockBits(GetAWInfo()->GetEEPId()), bits))
+		{
+			rv = GetBus()->WriteLockBits(bits, GetAWInfo()->GetEEPId());
+		}
 	}
 
 	return rv;
@@ -92,7 +98,12 @@ int At90sxx::FusesWrite(uint32_t bits)
 
 	if (rv > 0)
 	{
-		rv = GetBus()->WriteFuseBits(bits, GetAWInfo()->GetEEPId());
+		rv = OK;
+
+		if (ConfigChanged("Fuse", OK, GetBus()->ReadFuseBits(GetAWInfo()->GetEEPId()), bits))
+		{
+			rv = GetBus()->WriteFuseBits(bits, GetAWInfo()->GetEEPId());
+		}
 	}
 
 	return rv;
@@ -254,6 +265,28 @@ static IdType IdArray[] =
 	{0x00, 0x00,    AT90S0000}
 };
 
+//Signature bytes 1-2 -> type, built from IdArray at first use
+static long LookupSignature(int code1, int code2)
+{
+	static QHash<int, long> sig_hash;
+
+	if (sig_hash.isEmpty())
+	{
+		for (int k = 0; IdArray[k].code1 != 0x00; k++)
+		{
+			int key = (IdArray[k].code1 << 8) | IdArray[k].code2;
+
+			//Keep the first entry like the old linear search
+			if (!sig_hash.contains(key))
+			{
+				sig_hash.insert(key, IdArray[k].type);
+			}
+		}
+	}
+
+	return sig_hash.value((code1 << 8) | code2, 0);
+}
+
 int At90sxx::QueryType(long &type)
 {
 	int rv;
@@ -277,16 +310,7 @@ int At90sxx::QueryType(long &type)
 	}
 	else if (code[0] == 0x1E)
 	{
-		int k;
-
-		for (k = 0; IdArray[k].code1 != 0x00; k++)
-		{
-			if (IdArray[k].code1 == code[1] && IdArray[k].code2 == code[2])
-			{
-				type = IdArray[k].type;
-				break;
-			}
-		}
+		type = LookupSignature(code[1], code[2]);
 
 		if (type)
 		{
@@ -307,6 +331,15 @@ int At90sxx::QueryType(long &type)
 	return rv;
 }
 
+int At90sxx::Identify(long &type, int &confidence)
+{
+	int rv = QueryType(type);
+
+	confidence = (rv == OK) ? 100 : 0;
+
+	return rv;
+}
+
 // Probe() can change the bus according to the device detected.
 // Note that the Verify() operation don't call probe() before
 // to read the device, so it use the current bus. In the case
@@ -332,7 +365,7 @@ int At90sxx::Probe(int probe_size)
 	else
 	{
 		long type;
-		rv = QueryType(type);
+		rv = QueryTypeCached(type);
 		int subtype = GetE2PSubType(type);
 
 		if (rv == OK)
@@ -440,27 +473,51 @@ int At90sxx::Write(int probe, int type)
 			{
 				if (type & CONFIG_TYPE)
 				{
-					if (GetAWInfo()->GetEEPId() == AT90S4433 || GetAWInfo()->GetEEPId() == AT90S2333)
+					//read both first (the locks are already cleared by
+					// the chip erase), then write only what changes
+					long id = GetAWInfo()->GetEEPId();
+					uint32_t cur_fuse = GetBus()->ReadFuseBits(id);
+					uint32_t cur_lock = GetBus()->ReadLockBits(id);
+					uint32_t f;
+
+					if (id == AT90S4433 || id == AT90S2333)
 					{
 						//write the locks
-						uint32_t f = GetAWInfo()->GetLockBits();
-						GetBus()->WriteLockBits(f, GetAWInfo()->GetEEPId());
+						f = GetAWInfo()->GetLockBits();
+
+						if (ConfigChanged("Lock", OK, cur_lock, f))
+						{
+							GetBus()->WriteLockBits(f, id);
 
-						GetBus()->WaitMsec(100);
+							GetBus()->WaitMsec(100);
+						}
 
 						//write the fuses
 						f = GetAWInfo()->GetFuseBits();
-						GetBus()->WriteFuseBits(f, GetAWInfo()->GetEEPId());
+
+						if (ConfigChanged("Fuse", OK, cur_fuse, f))
+						{
+							GetBus()->WriteFuseBits(f, id);
+						}
 					}
 					else
 					{
 						//write the fuses
-						uint32_t f = GetAWInfo()->GetFuseBits();
-						GetBus()->WriteFuseBits(f, GetAWInfo()->GetEEPId());
+						f = GetAWInfo()->GetFuseBits();
+
+						if (ConfigChanged("Fuse", OK, cur_fuse, f))
+						{
+							GetBus()->WriteFuseBits(f, id);
+						}
 
 						//write the locks
+						// (last: they may disable further programming)
 						f = GetAWInfo()->GetLockBits();
-						GetBus()->WriteLockBits(f, GetAWInfo()->GetEEPId());
+
+						if (ConfigChanged("Lock", OK, cur_lock, f))
+						{
+							GetBus()->WriteLockBits(f, id);
+						}
 					}
 				}
 			}
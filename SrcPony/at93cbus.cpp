@@ -29,6 +29,7 @@
 #include "errcode.h"
 
 #include <QDebug>
+#include <QVector>
 
 #include "e2cmdw.h"
 
@@ -55,8 +56,10 @@ At93cBus::At93cBus(BusInterface *ptr)
 	  WriteCode(05),
 	  WriteEnableCode(04),
 	  EraseAllCode(04),
+	  WriteAllCode(04),
 	  PrClearCode(07),
 	  loop_timeout(8000),
+	  bulk_timeout(40000),
 	  address_len(6),         //9346
 	  organization(ORG16)
 {
@@ -76,16 +79,12 @@ int At93cBus::Erase(int type)
 	clearCS();
 	setCS();
 
-	SendCmdOpcode(EraseAllCode);
-	SendDataWord((2 << (address_len - 2)), address_len);
-
-	clearCS();
-	setCS();
+	int rv = BulkCommand(EraseAllCode, false);
 
 	SendCmdOpcode(WriteEnableCode);
 	SendDataWord(0, address_len);
 
-	return 1;
+	return (rv == OK) ? 1 : rv;
 }
 
 
@@ -149,16 +148,25 @@ long At93cBus::Read(int addr, uint8_t *data, long length, int page_size)
 		inc = 1;
 	}
 
+	bool seq = GetSeqRead();
+
 	//Dal piu` significativo al meno significativo
 	for (len = 0; len < length; len += inc)
 	{
 		//17/08/98 -- now repeat the command every word
-		clearCS();
-		setCS();
+		// (only the first one in sequential read, the address
+		// increments by itself and the next word follows without dummy bit)
+		if (!seq || len == 0)
+		{
+			clearCS();
+			setCS();
+
+			//Send command opcode
+			SendCmdOpcode(ReadCode);
+			SendAddress(addr, address_len);
+		}
 
-		//Send command opcode
-		SendCmdOpcode(ReadCode);
-		SendAddress(addr++, address_len);
+		addr++;
 
 		uint16_t val = RecDataWord(organization);
 
@@ -193,9 +201,49 @@ long At93cBus::Read(int addr, uint8_t *data, long length, int page_size)
 	return len;
 }
 
+//Legge una word, CS deve essere gia` attivo
+uint16_t At93cBus::ReadWord(int addr)
+{
+	SendCmdOpcode(ReadCode);
+	SendAddress(addr, address_len);
+	uint16_t val = RecDataWord(organization);
+
+	clearCS();
+	setCS();
+
+	return val;
+}
+
+//ERAL (indirizzo 10xxxx) o WRAL (01xxxx seguito dal dato) e attesa
+// della fine del ciclo. Richiede WEN gia` inviato.
+int At93cBus::BulkCommand(int code, bool write_all, uint16_t val)
+{
+	SendCmdOpcode(code);
+	SendDataWord((write_all ? 1 : 2) << (address_len - 2), address_len);
+
+	if (write_all)
+	{
+		SendDataWord(val, organization);
+	}
+
+	int rv = WaitReadyAfterWrite(bulk_timeout);
+
+	clearCS();
+	setCS();
+
+	return rv;
+}
+
+//Sceglie il piano con meno cicli di scrittura:
+// - WRITE di ogni word (solo quelle cambiate con la scrittura differenziale)
+// - ERAL e poi WRITE delle sole word diverse dal valore cancellato
+// - un solo WRAL se l'immagine e` uniforme
 long At93cBus::Write(int addr, uint8_t const *data, long length, int page_size)
 {
+	(void)page_size;
+
 	long curaddr;
+	uint16_t erased = (organization == ORG16) ? 0xFFFF : 0xFF;
 
 	WriteStart();
 
@@ -204,20 +252,16 @@ long At93cBus::Write(int addr, uint8_t const *data, long length, int page_size)
 		address_len = addr;
 	}
 
-	clearCS();                      //17/08/98 -- may be it's not needed
-	setCS();
-
-	SendCmdOpcode(WriteEnableCode);
-	SendDataWord(0xFFFF, address_len);
-
-	clearCS();
-	setCS();
-
 	if (organization == ORG16)
 	{
 		length >>= 1;        //byte to word  counter
 	}
 
+	QVector<uint16_t> words(length);
+	QVector<uint16_t> current;
+	long n_data = 0;
+	bool uniform = true;
+
 	for (curaddr = 0; curaddr < length; curaddr++)
 	{
 		uint16_t val;
@@ -237,29 +281,120 @@ long At93cBus::Write(int addr, uint8_t const *data, long length, int page_size)
 			val = *data++;
 		}
 
-		//Send command opcode
-		SendCmdOpcode(WriteCode);
-		SendAddress(curaddr, address_len);
-		SendDataWord(val, organization);
+		words[curaddr] = val;
 
-#if 1
+		if (val != erased)
+		{
+			n_data++;
+		}
 
-		if (WaitReadyAfterWrite(loop_timeout))
+		if (val != words[0])
 		{
-			return 0;        //- 07/08/99 a number >0 but != length mean "User abort"
+			uniform = false;
 		}
+	}
 
-#else
-		WaitMsec(10);
-#endif
-		clearCS();
-		setCS();
+	clearCS();                      //17/08/98 -- may be it's not needed
+	setCS();
+
+	//la "pagina" di una 93Cxx e` la singola word: con la scrittura
+	// differenziale si legge tutto prima per contare le word cambiate
+	long n_write = length;
 
-		if ((curaddr & 1))
-			if (WriteProgress(curaddr * 100 / length))
+	if (GetDiffWrite())
+	{
+		current.resize(length);
+		n_write = 0;
+
+		for (curaddr = 0; curaddr < length; curaddr++)
+		{
+			current[curaddr] = ReadWord(curaddr);
+
+			if (current[curaddr] != words[curaddr])
 			{
-				break;
+				n_write++;
+			}
+		}
+	}
+
+	bool use_eral = (1 + n_data < n_write);
+	bool use_wral = (uniform && length > 0 && 1 < (use_eral ? 1 + n_data : n_write));
+
+	qDebug() << "At93cBus::Write() words " << length << ", to write " << n_write << ", not erased " << n_data << (use_wral ? " WRAL" : (use_eral ? " ERAL" : ""));
+
+	SendCmdOpcode(WriteEnableCode);
+	SendDataWord(0xFFFF, address_len);
+
+	clearCS();
+	setCS();
+
+	if (use_wral)
+	{
+		if (BulkCommand(WriteAllCode, true, words[0]))
+		{
+			return 0;
+		}
+
+		PageWritten(length);
+		curaddr = length;
+	}
+	else
+	{
+		if (use_eral)
+		{
+			if (BulkCommand(EraseAllCode, false))
+			{
+				return 0;
+			}
+		}
+
+		for (curaddr = 0; curaddr < length; curaddr++)
+		{
+			uint16_t val = words[curaddr];
+			bool skip;
+
+			if (use_eral)
+			{
+				skip = (val == erased);
+			}
+			else
+			{
+				skip = GetDiffWrite() && (current[curaddr] == val);
+			}
+
+			if (skip)
+			{
+				PageSkipped();
+			}
+			else
+			{
+				PageWritten();
+
+				//Send command opcode
+				SendCmdOpcode(WriteCode);
+				SendAddress(curaddr, address_len);
+				SendDataWord(val, organization);
+
+#if 1
+
+				if (WaitReadyAfterWrite(loop_timeout))
+				{
+					return 0;        //- 07/08/99 a number >0 but != length mean "User abort"
+				}
+
+#else
+				WaitMsec(10);
+#endif
+				clearCS();
+				setCS();
 			}
+
+			if ((curaddr & 1))
+				if (WriteProgress(curaddr * 100 / length))
+				{
+					break;
+				}
+		}
 	}
 
 	SendCmdOpcode(WriteEnableCode);
@@ -65,6 +65,9 @@ class At93cBus : public MicroWireBus
 		return SendDataWord(opcode, 3);
 	}
 
+	uint16_t ReadWord(int addr);
+	int BulkCommand(int code, bool write_all, uint16_t val = 0);
+
   private:               //------------------------------- private
 
 	//Command Opcode
@@ -72,9 +75,11 @@ class At93cBus : public MicroWireBus
 	const uint8_t WriteCode;
 	const uint8_t WriteEnableCode;
 	const uint8_t EraseAllCode;
+	const uint8_t WriteAllCode;
 	const uint8_t PrClearCode;
 
 	const long loop_timeout;
+	const long bulk_timeout;                //ERAL/WRAL are slower than a single WRITE
 
 	void setCS()
 	{
@@ -34,7 +34,18 @@ BusIO::BusIO(BusInterface *p)
 			shot_delay(5),
 			busI(p),
 			old_progress(0),
-			last_programmed_addr(0)
+			last_programmed_addr(0),
+			diff_write(false),
+			pages_written(0),
+			pages_skipped(0),
+			inline_verify(false),
+			verify_fail_addr(-1),
+			seq_read(true),
+			blank_buf(0),
+			blank_base(0),
+			blank_len(0),
+			blank_progress(-1),
+			blank_scanned(0)
 {
 }
 
@@ -55,6 +66,36 @@ int BusIO::CheckAbort(int progress)
 	return abort;
 }
 
+//At every progress step scan only the bytes of the window read since the
+// last step: any byte not at 0xFF means the device is not blank, the read
+// can stop here
+int BusIO::BlankCheckStop(int progress)
+{
+	if (blank_buf == 0 || progress == blank_progress)
+	{
+		return 0;
+	}
+
+	blank_progress = progress;
+
+	long end = blank_base + blank_len;
+
+	if (progress < 100)
+	{
+		end = blank_base + (long)((long long)blank_len * progress / 100);
+	}
+
+	for (; blank_scanned < end; blank_scanned++)
+	{
+		if (blank_buf[blank_scanned] != 0xFF)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
 int BusIO::Error()
 {
 	int old_val = err_no;
@@ -75,7 +75,7 @@ class BusIO : public Wait
 	}
 	int ReadProgress(int progress)
 	{
-		return CheckAbort(progress);
+		return CheckAbort(progress) || BlankCheckStop(progress);
 	}
 
 	void WriteStart()
@@ -139,6 +139,13 @@ class BusIO : public Wait
 		return memcmp(data1, data2, length);
 	}
 
+	//Bytes compared together by CompareMultiWord() (a whole masked word)
+	virtual int CompareWordSize(int split) const
+	{
+		(void)split;
+		return 1;
+	}
+
 	int GetErrNo()
 	{
 		return err_no;
@@ -181,8 +188,98 @@ class BusIO : public Wait
 		}
 	}
 
+	//Differential write: pages whose content already matches are skipped
+	void SetDiffWrite(bool enabled)
+	{
+		diff_write = enabled;
+	}
+	bool GetDiffWrite() const
+	{
+		return diff_write;
+	}
+	void ClearPageStats()
+	{
+		pages_written = pages_skipped = 0;
+	}
+	void PageWritten(long n = 1)
+	{
+		pages_written += n;
+	}
+	void PageSkipped(long n = 1)
+	{
+		pages_skipped += n;
+	}
+	long GetPagesWritten() const
+	{
+		return pages_written;
+	}
+	long GetPagesSkipped() const
+	{
+		return pages_skipped;
+	}
+
+	//Inline verify: each page is read back as soon as its write cycle ends
+	void SetInlineVerify(bool enabled)
+	{
+		inline_verify = enabled;
+		verify_fail_addr = -1;
+	}
+	bool GetInlineVerify() const
+	{
+		return inline_verify;
+	}
+	long GetVerifyFailAddress() const
+	{
+		return verify_fail_addr;
+	}
+	int VerifyFailed(long addr)
+	{
+		verify_fail_addr = addr;
+		return E2ERR_VERIFYFAILED;
+	}
+
+	//Sequential read: a single command followed by the whole data stream,
+	// disabled for the parts that don't increment the address by themselves
+	void SetSeqRead(bool enabled)
+	{
+		seq_read = enabled;
+	}
+	bool GetSeqRead() const
+	{
+		return seq_read;
+	}
+
+	//Blank check: while a buffer filled with 0xFF is watched, ReadProgress()
+	// stops the read as soon as a byte in it gets a different value
+	void SetBlankCheck(uint8_t const *buf, long len)
+	{
+		blank_buf = buf;
+		SetBlankWindow(0, len);
+	}
+
+	//Part of the watched buffer filled by the next Read(), e.g. the data
+	// area after the split: the Read() progress applies to this window only
+	void SetBlankWindow(long base, long len)
+	{
+		blank_base = base;
+		blank_len = len;
+		blank_progress = -1;
+		blank_scanned = base;
+	}
+
   protected:             //------------------------------- protected
 
+	//Bus timing delay resolved at compile time by the bit-bang kernels,
+	// so TURBO mode (zero delay) doesn't call WaitUsec() at all
+	template <bool NoDelay>
+	void ShotDelay()
+	{
+		if (!NoDelay)
+		{
+			WaitUsec(shot_delay);
+		}
+	}
+
 	int     err_no;                 //error code
 	int     last_addr;
 
@@ -193,10 +290,26 @@ class BusIO : public Wait
   private:               //------------------------------- private
 
 	int CheckAbort(int progress = 0);
+	int BlankCheckStop(int progress);
 
 	int old_progress;
 	long last_programmed_addr;      //record last programmed address for verify
 
+	bool diff_write;
+	long pages_written;
+	long pages_skipped;
+
+	bool inline_verify;
+	long verify_fail_addr;          //first mismatch found by inline verify
+
+	bool seq_read;
+
+	uint8_t const *blank_buf;       //buffer watched by the blank check
+	long blank_base;                //window filled by the current Read()
+	long blank_len;
+	int blank_progress;
+	long blank_scanned;             //offset up to which bytes are at 0xFF
+
 };
 
 #endif
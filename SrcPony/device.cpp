@@ -31,6 +31,9 @@
 //=====>>> Costruttore <<<======
 Device::Device(e2AppWinInfo *wininfo, BusIO *busp, int b_size)
 	:       detected_type(0),
+			blank_addr(-1),
+			query_cached(false),
+			query_type(0),
 			awi(wininfo),
 			bus(busp),
 			def_bank_size(b_size),
@@ -153,6 +156,7 @@ int Device::ReadProg()
 	int size = GetSplitted();
 	int base = 0;
 
+	GetBus()->SetBlankWindow(base, size);
 	retval = GetBus()->Read(0, GetBufPtr() + base, size, read_progpage_size);
 
 	if (retval != size)
@@ -173,6 +177,7 @@ int Device::ReadData()
 	int size = GetSize() - GetSplitted();
 	int base = GetSplitted();
 
+	GetBus()->SetBlankWindow(base, size);
 	retval = GetBus()->Read(1, GetBufPtr() + base, size, read_datapage_size);
 
 	if (retval != size)
@@ -265,6 +270,11 @@ int Device::VerifyProg(unsigned char *localbuf)
 	else
 	{
 		rval = GetBus()->CompareMultiWord(GetBufPtr() + base, localbuf + base, v_len, 0) == 0 ? OK : 1;
+
+		if (rval != OK)
+		{
+			MapMismatches(base, localbuf + base, v_len, write_progpage_size);
+		}
 	}
 
 	return rval;
@@ -289,11 +299,167 @@ int Device::VerifyData(unsigned char *localbuf)
 	else
 	{
 		rval = GetBus()->CompareMultiWord(GetBufPtr() + base, localbuf + base, size, 1) == 0 ? OK : 1;
+
+		if (rval != OK)
+		{
+			MapMismatches(base, localbuf + base, size, write_datapage_size, 1);
+		}
 	}
 
 	return rval;
 }
 
+//The part can't change during a job (and stays powered inside a session),
+// so the signature/device ID is read only by the first Probe()
+int Device::QueryTypeCached(long &type)
+{
+	int rv = OK;
+
+	if (!query_cached)
+	{
+		rv = QueryType(query_type);
+		query_cached = (rv == OK);
+	}
+
+	type = query_type;
+
+	return rv;
+}
+
+//Ogni scrittura di fuse/lock costa un ciclo di scrittura (e usura):
+// il campo va scritto solo se quello letto dal chip e` diverso, o se
+// non e` stato possibile leggerlo (read_rv != OK). L'esito va nel report.
+bool Device::ConfigChanged(const QString &field, int read_rv, uint32_t current, uint32_t wanted)
+{
+	ConfigFieldResult res;
+
+	res.field = field;
+	res.changed = (read_rv != OK || current != wanted);
+	config_report.append(res);
+
+	qDebug() << "Device::ConfigChanged(" << field << ") " << (hex) << current << " -> " << wanted << (dec) << (res.changed ? " write" : " skip");
+
+	return res.changed;
+}
+
+//Legge nel buffer, salvandone prima il contenuto, riempito di 0xFF:
+// il bus interrompe la lettura appena vi trova un byte diverso
+int Device::BlankCheck(int type)
+{
+	int rval;
+	long bufsize = GetBufSize();
+	uint8_t *savebuf = new uint8_t[bufsize];
+
+	memcpy(savebuf, GetBufPtr(), bufsize);
+	memset(GetBufPtr(), 0xFF, bufsize);
+
+	//ReadProg()/ReadData() restrict the window to their own area
+	blank_addr = -1;
+	GetBus()->SetBlankCheck(GetBufPtr(), GetSize() > 0 ? GetSize() : bufsize);
+	rval = Read(GetNoOfBank() == 0, type & (PROG_TYPE | DATA_TYPE));
+	GetBus()->SetBlankCheck(0, 0);
+
+	long k;
+
+	for (k = 0; k < bufsize; k++)
+	{
+		if (GetBufPtr()[k] != 0xFF)
+		{
+			blank_addr = k;
+			break;
+		}
+	}
+
+	memcpy(GetBufPtr(), savebuf, bufsize);
+	delete[] savebuf;
+
+	if (blank_addr >= 0)
+	{
+		rval = E2ERR_BLANKCHECKFAILED;
+	}
+	else if (rval > 0)
+	{
+		rval = OK;
+	}
+	else if (rval == 0)
+	{
+		rval = DEVICE_UNKNOWN;
+	}
+
+	return rval;
+}
+
+//Confronta data (letto dal dispositivo) con il buffer da base in poi e
+// aggiunge alla mappa una voce per ogni pagina diversa. split viene
+// passato a CompareMultiWord() per ignorare i bit non implementati, anche
+// nel conteggio dei byte diversi.
+void Device::MapMismatches(long base, uint8_t const *data, long len, long page_size, int split)
+{
+	long addr;
+	long word = GetBus()->CompareWordSize(split);
+
+	if (page_size <= 0)
+	{
+		page_size = 256;
+	}
+
+	for (addr = base - base % page_size; addr < base + len; addr += page_size)
+	{
+		long from = (addr < base) ? base : addr;
+		long to = addr + page_size;
+
+		if (to > base + len)
+		{
+			to = base + len;
+		}
+
+		uint8_t const *dev = data + (from - base);
+
+		if (GetBus()->CompareMultiWord(GetBufPtr() + from, (uint8_t *)dev, to - from, split) == 0)
+		{
+			continue;
+		}
+
+		VerifyMismatch m;
+		long k;
+
+		m.page = addr / page_size;
+		m.addr = addr;
+		m.page_size = page_size;
+		m.first = -1;
+		m.last = -1;
+		m.count = 0;
+
+		for (k = from; k < to; k += word)
+		{
+			long w = (to - k < word) ? to - k : word;
+
+			if (GetBus()->CompareMultiWord(GetBufPtr() + k, (uint8_t *)dev + (k - from), w, split) == 0)
+			{
+				continue;
+			}
+
+			long j;
+
+			for (j = k; j < k + w; j++)
+			{
+				if (GetBufPtr()[j] != dev[j - from])
+				{
+					if (m.first < 0)
+					{
+						m.first = j;
+					}
+
+					m.last = j;
+					m.count++;
+				}
+			}
+		}
+
+		mismatch_map.append(m);
+	}
+}
+
 int Device::ReadCalibration(int addr)
 {
 	int val;
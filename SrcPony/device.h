@@ -28,6 +28,7 @@
 #define _DEVICE_H
 
 #include <QString>
+#include <QVector>
 
 #include "types.h"
 #include "globals.h"
@@ -35,6 +36,24 @@
 
 class e2AppWinInfo;
 
+//Verify mismatch map: one entry for every page that differs
+struct VerifyMismatch
+{
+	long page;              //page index (address / page size)
+	long addr;              //address of the page in the buffer
+	long page_size;         //page size of the memory area the page is in
+	long first;             //address of the first differing byte
+	long last;              //address of the last differing byte
+	long count;             //number of differing bytes
+};
+
+//Config write report: one entry for every fuse/lock/config field
+struct ConfigFieldResult
+{
+	QString field;
+	bool changed;           //false if the device already had the value
+};
+
 class Device
 {
   public:               //---------------------------------------- public
@@ -97,6 +116,68 @@ class Device
 
 	virtual int ReadCalibration(int addr = 0);
 
+	//Mismatch map of the last Verify()
+	QVector<VerifyMismatch> const &GetMismatchMap() const
+	{
+		return mismatch_map;
+	}
+	void ClearMismatchMap()
+	{
+		mismatch_map.clear();
+	}
+
+	//Fields of the last config write, and whether they were written
+	QVector<ConfigFieldResult> const &GetConfigReport() const
+	{
+		return config_report;
+	}
+	void ClearConfigReport()
+	{
+		config_report.clear();
+	}
+
+	//Reprogram only the pages of the mismatch map, each up to retries
+	// times, then verify them again. Returns 1 if all of them now match.
+	virtual int Repair(int retries)
+	{
+		(void)retries;
+		return NOTSUPPORTED;
+	}
+
+	//Non destructive identification of the part in the socket: only IDs,
+	// signatures or status registers are read. On OK type is set and
+	// confidence tells how sure it is (100 = exact device ID).
+	virtual int Identify(long &type, int &confidence)
+	{
+		(void)type;
+		(void)confidence;
+		return NOTSUPPORTED;
+	}
+
+	//Results of slow probes (size detection) are kept until this is called,
+	// that is at the start of every new job
+	virtual void ClearProbeCache()
+	{
+		query_cached = false;
+	}
+
+	//Blank check: the memory is read by the family Read() (with its fastest
+	// mode) and the read stops at the first byte not at the erased value.
+	// Returns OK if blank, E2ERR_BLANKCHECKFAILED otherwise.
+	virtual int BlankCheck(int type = ALL_TYPE);
+	long GetBlankCheckAddress() const
+	{
+		return blank_addr;
+	}
+
+	//true if Write() can read back every page as soon as it is written,
+	// so that a separate Verify() is not needed
+	virtual bool CanInlineVerify(int type) const
+	{
+		(void)type;
+		return false;
+	}
+
 	//--------
 	void SetAWInfo(e2AppWinInfo *wininfo);
 	BusIO *GetBus() const
@@ -165,9 +246,29 @@ class Device
 		return awi;
 	}
 
+	void MapMismatches(long base, uint8_t const *data, long len, long page_size, int split = 0);
+	bool ConfigChanged(const QString &field, int read_rv, uint32_t current, uint32_t wanted);
+
+	//Device ID read by the family, QueryTypeCached() reads it once per job
+	virtual int QueryType(long &type)
+	{
+		(void)type;
+		return NOTSUPPORTED;
+	}
+	int QueryTypeCached(long &type);
+
 	long detected_type;
 	QString detected_signature;
 
+	QVector<VerifyMismatch> mismatch_map;
+
+	QVector<ConfigFieldResult> config_report;
+
+	long blank_addr;                //first byte not blank found by BlankCheck(), -1 if none
+
+	bool query_cached;              //query_type is valid for the current job
+	long query_type;
+
   private:              //--------------------------------------- private
 
 	e2AppWinInfo *awi;      // pointer to container object
@@ -27,6 +27,8 @@
 // Total capacity can be up to 64KBytes.                                   //
 
 #include <QString>
+#include <QDebug>
+#include <QElapsedTimer>
 
 #include "types.h"
 #include "e2profil.h"
@@ -42,10 +44,11 @@ E24xx2::E24xx2(e2AppWinInfo *wininfo, BusIO *busp)
 			SecurityReadCode(0xC0),
 			SecurityWriteCode(0x80),
 			HEnduranceReadCode(0x40),
-			HEnduranceWriteCode(0x00)
+			HEnduranceWriteCode(0x00),
+			gang_count(0)
 {
-	writepage_size = E2Profile::GetI2CPageWrite();
-	E2Profile::SetI2CPageWrite(writepage_size);
+	def_writepage_size = 16;        //se il tipo non specifica la pagina
+	writepage_size = def_writepage_size;
 }
 
 int E24xx2::Probe(int probe_size)
@@ -56,6 +59,9 @@ int E24xx2::Probe(int probe_size)
 	{
 		long size = GetSize();
 
+		//Ogni indirizzo che risponde e` una EEPROM distinta (A0-A2)
+		gang_count = (rval > MAX_GANG) ? MAX_GANG : rval;
+
 		n_bank = 1;
 		SetBankSize(size / n_bank);
 		SetNoOfBank(n_bank);
@@ -64,6 +70,123 @@ int E24xx2::Probe(int probe_size)
 	return rval;
 }
 
+//In gang mode ogni chip va verificato separatamente
+bool E24xx2::CanInlineVerify(int type) const
+{
+	(void)type;
+	return !GangEnabled();
+}
+
+bool E24xx2::GangEnabled() const
+{
+	return gang_count > 1 && E2Profile::GetI2CGangMode();
+}
+
+//Scheduler cooperativo: ogni EEPROM avanza per conto suo. A ogni giro
+// si interroga (senza attendere) ogni chip ancora in ciclo di scrittura
+// e si invia la pagina successiva a quelli pronti, cosi` un chip lento
+// non blocca gli altri. Ogni ciclo di scrittura ha una scadenza di
+// write_timeout msec; un chip che fallisce viene escluso senza fermare
+// gli altri.
+int E24xx2::GangWrite(uint8_t *localbuf)
+{
+	long size = GetSize();
+	long next[MAX_GANG];                    //prossima pagina da scrivere
+	bool busy[MAX_GANG];                    //ciclo di scrittura in corso
+	QElapsedTimer started[MAX_GANG];
+	long pages = (size + writepage_size - 1) / writepage_size;
+	long written = 0;
+	int remaining = gang_count;
+	int failed;
+	int k;
+
+	for (k = 0; k < gang_count; k++)
+	{
+		gang_result[k] = OK;
+		next[k] = 0;
+		busy[k] = false;
+	}
+
+	while (remaining > 0)
+	{
+		long old_written = written;
+
+		remaining = 0;
+
+		for (k = 0; k < gang_count; k++)
+		{
+			if (gang_result[k] != OK)
+			{
+				continue;
+			}
+
+			if (busy[k])
+			{
+				if (!IsWriteReady(eeprom_addr[k]))
+				{
+					if (started[k].elapsed() > write_timeout)
+					{
+						gang_result[k] = E2P_TIMEOUT;
+					}
+					else
+					{
+						remaining++;
+					}
+
+					continue;
+				}
+
+				busy[k] = false;
+			}
+
+			if (next[k] >= size)
+			{
+				continue;               //completato
+			}
+
+			long j = next[k];
+
+			memcpy(localbuf + 2, GetBufPtr() + j, writepage_size);
+
+			localbuf[0] = (uint8_t)((j >> 8) & 0xFF);
+			localbuf[1] = (uint8_t)(j & 0xFF);
+
+			if (GetBus()->Write(eeprom_addr[k], localbuf, 2 + writepage_size) != (2 + writepage_size))
+			{
+				gang_result[k] = GetBus()->Error();
+				continue;
+			}
+
+			started[k].start();
+			busy[k] = true;
+			next[k] += writepage_size;
+			written++;
+			remaining++;
+		}
+
+		if (written != old_written && GetBus()->WriteProgress(written * 100 / (pages * gang_count)))
+		{
+			return OP_ABORTED;
+		}
+	}
+
+	failed = 0;
+
+	for (k = 0; k < gang_count; k++)
+	{
+		if (gang_result[k] != OK)
+		{
+			failed++;
+		}
+
+		qDebug() << "E24xx2::GangWrite() chip @" << (hex) << eeprom_addr[k] << (dec) << "=" << gang_result[k];
+	}
+
+	//Basta un chip fallito per far fallire la scrittura, quale sia
+	// lo dice GetGangResult()
+	return (failed > 0) ? E2ERR_WRITEFAILED : OK;
+}
+
 int E24xx2::Write(int probe, int type)
 {
 	int error = Probe(probe || GetNoOfBank() == 0);
@@ -81,38 +204,78 @@ int E24xx2::Write(int probe, int type)
 	GetBus()->WriteStart();
 
 	long size = GetSize();
-	unsigned char *localbuf = new unsigned char[writepage_size + 2];
+	unsigned char *localbuf = new unsigned char[2 * writepage_size + 2];     //index, data, read back
 
 	int rval = OK;
 
-	if (type & PROG_TYPE)
+	if ((type & PROG_TYPE) && GangEnabled())
+	{
+		rval = GangWrite(localbuf);
+
+		//il probe ha trovato piu` chip dopo che era stato scelto il verify
+		// inline: il chiamante non fara` il Verify(), va fatto qui
+		if (rval == OK && GetBus()->GetInlineVerify())
+		{
+			int v = Verify(PROG_TYPE);
+
+			if (v == 0)
+			{
+				rval = E2ERR_VERIFYFAILED;
+			}
+			else if (v < 0)
+			{
+				rval = v;
+			}
+		}
+	}
+	else if (type & PROG_TYPE)
 	{
 		long j;
 
 		for (j = 0; j < size; j += writepage_size)
 		{
-			memcpy(localbuf + 2, GetBufPtr() + j, writepage_size);
-
 			localbuf[0] = (uint8_t)((j >> 8) & 0xFF);
 			localbuf[1] = (uint8_t)(j & 0xFF);
 
+			if (GetBus()->GetDiffWrite())
+			{
+				if (PageMatches(eeprom_addr[0], localbuf, 2, GetBufPtr() + j, writepage_size, localbuf + 2))
+				{
+					GetBus()->PageSkipped();
+
+					if (GetBus()->WriteProgress(j * 100 / size))
+					{
+						rval = OP_ABORTED;
+						break;
+					}
+
+					continue;
+				}
+
+				GetBus()->PageWritten();
+			}
+
+			memcpy(localbuf + 2, GetBufPtr() + j, writepage_size);
+
 			if (GetBus()->Write(eeprom_addr[0], localbuf, 2 + writepage_size) != (2 + writepage_size))
 			{
 				rval = GetBus()->Error();
 				break;
 			}
 
-			int k;
-
-			for (k = timeout_loop; k > 0 && GetBus()->Read(eeprom_addr[0], localbuf, 1) != 1; k--)
-				;
-
-			if (k == 0)
+			if (WaitWriteCycle(eeprom_addr[0]) != OK)
 			{
 				rval = E2P_TIMEOUT;
 				break;
 			}
 
+			if (GetBus()->GetInlineVerify() &&
+					!PageMatches(eeprom_addr[0], localbuf, 2, GetBufPtr() + j, writepage_size, localbuf + 2 + writepage_size))
+			{
+				rval = GetBus()->VerifyFailed(j);
+				break;
+			}
+
 			if (GetBus()->WriteProgress(j * 100 / size))
 			{
 				rval = OP_ABORTED;
@@ -151,34 +314,18 @@ int E24xx2::Read(int probe, int type)
 	if (type & PROG_TYPE)
 	{
 		uint8_t index[2];
-		long readpage_size = 256;
-		long k;
 		long size = GetSize();
+		long readpage_size = GetSeqReadChunk(size, 256);
+		long k;
 
-		for (k = 0; k < size; k += readpage_size)
+		//di solito tutta la memoria in una sola transazione
+		for (k = 0; k < size && error == OK; k += readpage_size)
 		{
 			//Scrive l'indice del sottoindirizzamento
-			// partiamo sempre da 0.
 			index[0] = (uint8_t)((k >> 8) & 0xFF);
 			index[1] = (uint8_t)(k & 0xFF);
 
-			if (GetBus()->StartWrite(eeprom_addr[0], index, 2) != 2)
-			{
-				error = GetBus()->Error();
-				break;
-			}
-
-			if (GetBus()->Read(eeprom_addr[0], GetBufPtr() + k, readpage_size) < readpage_size)
-			{
-				error = GetBus()->Error();
-				break;
-			}
-
-			if (GetBus()->ReadProgress(k * 100 / size))
-			{
-				error = OP_ABORTED;
-				break;
-			}
+			error = SequentialRead(eeprom_addr[0], index, 2, GetBufPtr() + k, readpage_size, k, size);
 		}
 	}
 
@@ -203,56 +350,162 @@ int E24xx2::Verify(int type)
 		return rval;
 	}
 
-	long readpage_size = 256;
-	unsigned char *localbuf = new unsigned char[readpage_size];
+	unsigned char *localbuf = new unsigned char[GetSeqReadChunk(GetSize(), 256)];
 
 	GetBus()->ReadStart();
 
 	rval = 1;               //true
 
-	if (type & PROG_TYPE)
+	if ((type & PROG_TYPE) && GangEnabled())
 	{
-		uint8_t index[2];
-		long k;
-		long size = GetSize();
+		int k;
 
-		for (k = 0; k < size; k += readpage_size)
+		//Verifica tutte le EEPROM anche se una non corrisponde,
+		// in modo da poter riportare il risultato di ciascuna
+		for (k = 0; k < gang_count && rval != OP_ABORTED; k++)
 		{
-			//Scrive l'indice del sottoindirizzamento
-			// partiamo sempre da 0.
-			index[0] = (uint8_t)((k >> 8) & 0xFF);
-			index[1] = (uint8_t)(k & 0xFF);
+			int v = VerifyChip(eeprom_addr[k], localbuf, k, gang_count);
 
-			if (GetBus()->StartWrite(eeprom_addr[0], index, 2) != 2)
+			if (v == OP_ABORTED)
 			{
-				rval = GetBus()->Error();
-				break;
+				rval = OP_ABORTED;
+			}
+			else if (v <= 0)
+			{
+				gang_result[k] = (v == 0) ? CMD_VERIFYFAILED : v;
+				rval = 0;
+			}
+			else
+			{
+				gang_result[k] = OK;
 			}
 
-			if (GetBus()->Read(eeprom_addr[0], localbuf, readpage_size) < readpage_size)
+			qDebug() << "E24xx2::Verify() chip @" << (hex) << eeprom_addr[k] << (dec) << "=" << v;
+		}
+	}
+	else if (type & PROG_TYPE)
+	{
+		rval = VerifyChip(eeprom_addr[0], localbuf, 0, 1);
+	}
+
+	GetBus()->ReadEnd();
+
+	delete[] localbuf;
+	return rval;
+}
+
+//Confronta il contenuto di una EEPROM con il buffer,
+// chip_no/chip_count servono solo per la barra di avanzamento
+int E24xx2::VerifyChip(int addr, uint8_t *localbuf, int chip_no, int chip_count)
+{
+	bool match = true;
+	uint8_t index[2];
+	long size = GetSize();
+	long readpage_size = GetSeqReadChunk(size, 256);
+	long k;
+
+	for (k = 0; k < size; k += readpage_size)
+	{
+		//Scrive l'indice del sottoindirizzamento
+		index[0] = (uint8_t)((k >> 8) & 0xFF);
+		index[1] = (uint8_t)(k & 0xFF);
+
+		int error = SequentialRead(addr, index, 2, localbuf, readpage_size, chip_no * size + k, chip_count * size);
+
+		if (error != OK)
+		{
+			return error;
+		}
+
+		if (memcmp(GetBufPtr() + k, localbuf, readpage_size) != 0)
+		{
+			if (chip_count > 1)
 			{
-				rval = GetBus()->Error();
-				break;
+				return 0;
 			}
 
-			if (memcmp(GetBufPtr() + k, localbuf, readpage_size) != 0)
+			//prosegue fino alla fine per costruire la mappa delle differenze
+			MapMismatches(k, localbuf, readpage_size, writepage_size);
+			match = false;
+		}
+	}
+
+	return match ? 1 : 0;
+}
+
+//Riscrive solo le pagine della mappa delle differenze
+int E24xx2::Repair(int retries)
+{
+	int error = Probe();
+
+	if (error < 0)
+	{
+		return error;
+	}
+
+	if (GangEnabled())
+	{
+		return NOTSUPPORTED;    //la mappa e` di un solo chip
+	}
+
+	long max_page = 0;
+	int k;
+
+	for (k = 0; k < mismatch_map.size(); k++)
+	{
+		if (mismatch_map[k].page_size <= 0)
+		{
+			return BADPARAM;
+		}
+
+		if (mismatch_map[k].page_size > max_page)
+		{
+			max_page = mismatch_map[k].page_size;
+		}
+	}
+
+	unsigned char *localbuf = new unsigned char[2 * max_page + 2];       //index, data, read back
+
+	GetBus()->WriteStart();
+
+	for (k = mismatch_map.size() - 1; k >= 0; k--)
+	{
+		long page_size = mismatch_map[k].page_size;
+		long addr = mismatch_map[k].addr;
+		int n;
+
+		localbuf[0] = (uint8_t)((addr >> 8) & 0xFF);
+		localbuf[1] = (uint8_t)(addr & 0xFF);
+		memcpy(localbuf + 2, GetBufPtr() + addr, page_size);
+
+		for (n = 0; n < retries; n++)
+		{
+			if (GetBus()->Write(eeprom_addr[0], localbuf, 2 + page_size) != 2 + page_size)
 			{
-				rval = 0;
-				break;
+				GetBus()->Error();
+				continue;
 			}
 
-			if (GetBus()->ReadProgress(k * 100 / size))
+			if (WaitWriteCycle(eeprom_addr[0]) == OK &&
+					PageMatches(eeprom_addr[0], localbuf, 2, GetBufPtr() + addr, page_size, localbuf + 2 + page_size))
 			{
-				rval = OP_ABORTED;
 				break;
 			}
 		}
+
+		qDebug() << "E24xx2::Repair() page" << mismatch_map[k].page << ((n < retries) ? "repaired" : "failed");
+
+		if (n < retries)
+		{
+			mismatch_map.remove(k);
+		}
 	}
 
-	GetBus()->ReadEnd();
+	GetBus()->WriteEnd();
 
 	delete[] localbuf;
-	return rval;
+
+	return mismatch_map.isEmpty() ? 1 : 0;
 }
 
 
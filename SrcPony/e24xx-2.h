@@ -42,6 +42,9 @@ class E24xx2 : public E24xx
 	int Write(int probe = 1, int type = ALL_TYPE);
 	int Verify(int type = ALL_TYPE);
 
+	bool CanInlineVerify(int type) const;
+	int Repair(int retries);
+
 	//      int BankRollOverDetect(int force);
 
 	int SecurityRead(uint32_t &blocks);
@@ -49,13 +52,41 @@ class E24xx2 : public E24xx
 	int HighEnduranceRead(uint32_t &block_no);
 	int HighEnduranceWrite(uint32_t block_no);
 
+	//Gang mode: same image on all the EEPROMs found on the bus
+	int GetGangCount() const
+	{
+		return gang_count;
+	}
+
+	int GetGangAddress(int k) const
+	{
+		return eeprom_addr[k];
+	}
+
+	int GetGangResult(int k) const
+	{
+		return gang_result[k];
+	}
+
   protected:    //--------------------------------------- protected
 
   private:              //--------------------------------------- private
 
+	int GangWrite(uint8_t *localbuf);
+	int VerifyChip(int addr, uint8_t *localbuf, int chip_no, int chip_count);
+	bool GangEnabled() const;
+
 	int const SecurityReadCode;
 	int const SecurityWriteCode;
 	int const HEnduranceReadCode;
 	int const HEnduranceWriteCode;
+
+	enum
+	{
+		MAX_GANG = 8            // A0-A2 address pins
+	};
+
+	int gang_count;                 // EEPROMs that answer on the bus
+	int gang_result[MAX_GANG];      // last Write/Verify result for each EEPROM
 };
 #endif
@@ -39,7 +39,8 @@ E24xx5::E24xx5(e2AppWinInfo *wininfo, BusIO *busp)
 {
 	//      writepage_size = E2Profile::GetI2CPageWrite();
 	//      E2Profile::SetI2CPageWrite(writepage_size);
-	writepage_size = 32;
+	def_writepage_size = 32;
+	writepage_size = def_writepage_size;
 
 	base_addr = 0x00;               // 24C325 or 24C645 use non standard I2C Bus address, Probe() will try ALL possible I2C Adresses from 0x00 to 0xFE
 }
@@ -84,12 +85,7 @@ int E24xx5::Write(int probe, int type)
 		}
 
 		//Ack polling
-		int k;
-
-		for (k = timeout_loop; k > 0 && GetBus()->Read(eeprom_addr[0], buffer, 1) != 1; k--)
-			;
-
-		if (k == 0)
+		if (WaitWriteCycle(eeprom_addr[0]) != OK)
 		{
 			return E2P_TIMEOUT;
 		}
@@ -35,15 +35,25 @@
 #include "eeptypes.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
+
+#define MAX_BANK_SIZE	256
 
 //=====>>> Costruttore <<<======
 E24xx::E24xx(e2AppWinInfo *wininfo, BusIO *busp, int max_no_of_bank, int def_banksize)
 	:       Device(wininfo, busp, def_banksize),
 			max_bank(max_no_of_bank),
-			timeout_loop(200),
+			write_timeout(100),
 			n_bank(0),
 			sequential_read(1),             // lettura di un banco alla volta
-			writepage_size(1)               // scrittura di un byte alla volta (no page write)
+			writepage_size(1),              // scrittura di un byte alla volta (no page write)
+			def_writepage_size(1),
+			seqread_size(0),
+			twr_estimate(0),
+			twr_last(0),
+			twr_max(0),
+			alias_nbank(-1),
+			alias_acked(0)
 {
 	//      qDebug() << "E24xx" << THEAPP;
 	base_addr = E2Profile::GetI2CBaseAddr();
@@ -63,6 +73,205 @@ E24xx::~E24xx()
 {
 }
 
+//Un solo ACK polling: true se la EEPROM ha terminato il ciclo di
+// scrittura e risponde al suo indirizzo I2C
+bool E24xx::IsWriteReady(int addr)
+{
+	return GetBus()->ProbeAck(addr);
+}
+
+//Scrittura differenziale: true se la pagina nella EEPROM contiene
+// gia` i dati da scrivere. scratch deve contenere almeno len bytes.
+bool E24xx::PageMatches(int addr, uint8_t const *index, int index_len, uint8_t const *data, int len, uint8_t *scratch)
+{
+	if (GetBus()->StartWrite(addr, index, index_len) != index_len ||
+			GetBus()->Read(addr, scratch, len) != len)
+	{
+		GetBus()->Error();      //la pagina verra` comunque scritta
+		return false;
+	}
+
+	return memcmp(scratch, data, len) == 0;
+}
+
+//Riscrive solo le pagine della mappa delle differenze
+int E24xx::Repair(int retries)
+{
+	int error = Probe();
+
+	if (error < 0)
+	{
+		return error;
+	}
+
+	uint8_t buffer[MAX_BANK_SIZE + 1];
+	uint8_t scratch[MAX_BANK_SIZE];
+	int k;
+
+	for (k = 0; k < mismatch_map.size(); k++)
+	{
+		long page_size = mismatch_map[k].page_size;
+
+		if (page_size <= 0 || page_size > GetBankSize() || (GetBankSize() % page_size) != 0)
+		{
+			return BADPARAM;
+		}
+	}
+
+	GetBus()->WriteStart();
+
+	for (k = mismatch_map.size() - 1; k >= 0; k--)
+	{
+		long page_size = mismatch_map[k].page_size;
+		long addr = mismatch_map[k].addr;
+		int bank = addr / GetBankSize();
+		int n;
+
+		buffer[0] = (uint8_t)(addr % GetBankSize());
+		memcpy(buffer + 1, GetBufPtr() + addr, page_size);
+
+		for (n = 0; n < retries; n++)
+		{
+			if (GetBus()->Write(eeprom_addr[bank], buffer, 1 + page_size) != 1 + page_size)
+			{
+				GetBus()->Error();
+				continue;
+			}
+
+			if (WaitWriteCycle(eeprom_addr[bank]) == OK &&
+					PageMatches(eeprom_addr[bank], buffer, 1, buffer + 1, page_size, scratch))
+			{
+				break;
+			}
+		}
+
+		qDebug() << "E24xx::Repair() page" << mismatch_map[k].page << ((n < retries) ? "repaired" : "failed");
+
+		if (n < retries)
+		{
+			mismatch_map.remove(k);
+		}
+	}
+
+	GetBus()->WriteEnd();
+
+	return mismatch_map.isEmpty() ? 1 : 0;
+}
+
+//Attende la fine del ciclo di scrittura interrogando l'indirizzo
+// I2C finche` la EEPROM non risponde con ACK (ACK polling).
+// Prima di interrogare attende quasi tutto il tWR misurato, poi
+// ripete il probe con un intervallo crescente fino alla scadenza
+// di write_timeout msec (indipendente dalla velocita` del bus).
+int E24xx::WaitWriteCycle(int addr)
+{
+	QElapsedTimer timer;
+	int backoff = 20;               //usec
+	bool early = true;
+
+	timer.start();
+
+	if (twr_estimate > 0)
+	{
+		GetBus()->WaitUsec(twr_estimate - twr_estimate / 8);
+	}
+
+	while (!IsWriteReady(addr))
+	{
+		early = false;
+
+		if (timer.elapsed() > write_timeout)
+		{
+			qDebug() << "E24xx::WaitWriteCycle() timeout @" << (hex) << addr << (dec);
+			return E2P_TIMEOUT;
+		}
+
+		GetBus()->WaitUsec(backoff);
+
+		if (backoff < 200)
+		{
+			backoff *= 2;
+		}
+	}
+
+	RecordWriteCycle((long)(timer.nsecsElapsed() / 1000), early);
+
+	return OK;
+}
+
+//Aggiorna la stima di tWR. Se la EEPROM era gia` pronta al primo
+// probe il tempo reale e` minore di quello misurato: si riduce la
+// stima in modo che il primo probe cada sul momento in cui e` pronta.
+void E24xx::RecordWriteCycle(long usec, bool early)
+{
+	twr_last = usec;
+
+	if (usec > twr_max)
+	{
+		twr_max = usec;
+	}
+
+	if (twr_estimate == 0)
+	{
+		twr_estimate = usec;
+	}
+	else if (early)
+	{
+		twr_estimate -= twr_estimate / 8;
+	}
+	else
+	{
+		twr_estimate = (twr_estimate * 3 + usec) / 4;
+	}
+}
+
+//Dimensione pagina e lettura sequenziale dalla tabella dei dispositivi,
+// il valore nel profilo e` solo un override esplicito
+void E24xx::SetupPageGeometry()
+{
+	long type = GetAWInfo()->GetEEPId();
+	int page_size = E2Profile::GetI2CPageWrite();
+
+	if (page_size <= 0)
+	{
+		page_size = GetEEPTypeWPageSize(type);
+	}
+
+	if (page_size <= 0 || page_size > MAX_BANK_SIZE)
+	{
+		page_size = def_writepage_size;
+	}
+
+	writepage_size = page_size;
+	seqread_size = GetEEPTypeSeqReadSize(type);
+
+	qDebug() << "E24xx::SetupPageGeometry() page = " << writepage_size << ", seqread = " << seqread_size;
+}
+
+//Legge len byte a partire da index con un solo indirizzamento,
+// l'avanzamento e` relativo a progress_total
+int E24xx::SequentialRead(int addr, uint8_t const *index, int index_len, uint8_t *buf, long len,
+						  long progress_base, long progress_total, int lsb)
+{
+	if (GetBus()->ReadSequential(addr, index, index_len, buf, len, progress_base, progress_total, lsb) == len)
+	{
+		return OK;
+	}
+
+	int error = GetBus()->Error();
+
+	return (error != OK) ? error : OP_ABORTED;
+}
+
+//Lunghezza massima di una lettura sequenziale, def_size se il tipo
+// non la specifica
+long E24xx::GetSeqReadChunk(long size, long def_size) const
+{
+	long chunk = (seqread_size > 0) ? seqread_size : def_size;
+
+	return (chunk > 0 && chunk < size) ? chunk : size;
+}
+
 //Determina a quali indirizzi I2C si mappa, e
 // se probe_size == 1 anche la dimensione (numero di banchi)
 //---
@@ -75,6 +284,9 @@ int E24xx::Probe(int probe_size)
 
 	n_bank = 0;
 
+	GetBus()->SetTimingMode(GetEEPTypeI2CMode(GetAWInfo()->GetEEPId()));
+	SetupPageGeometry();
+
 	for (addr = base_addr, k = 0; k < max_bank; k++, addr += 2)
 	{
 		if (GetBus()->Read(addr, &ch, 1) != 1)
@@ -91,6 +303,18 @@ int E24xx::Probe(int probe_size)
 		}
 	}
 
+	//24XX Auto: le EEPROM che ignorano i pin A0-A2 rispondono a piu` indirizzi
+	if (n_bank > 1 && GetAWInfo()->GetEEPId() == E2400)
+	{
+		if (alias_nbank < 0 || alias_acked != n_bank)
+		{
+			alias_acked = n_bank;
+			alias_nbank = AliasBankDetect(n_bank);
+		}
+
+		n_bank = alias_nbank;
+	}
+
 	if (probe_size)
 	{
 		SetNoOfBank(n_bank);
@@ -122,17 +346,40 @@ int E24xx::Read(int probe, int type)
 		//modificata in modo che legga sempre tutto l'intero
 		// contenuto del dispositivo indipendentemente dalla
 		// capacita` correntemente selezionata
-		for (k = 0; k < n_bank; k++)
+		long total = (long)n_bank * GetBankSize();
+		uint8_t index = 0;
+
+		if (sequential_read && GetSeqReadChunk(total, GetBankSize()) == total)
 		{
-			if ((error = bank_in(GetBufPtr() + k * GetBankSize(), k)))
+			//tutta la memoria in una sola transazione
+			if ((error = SequentialRead(eeprom_addr[0], &index, 1, GetBufPtr(), total, 0, total)))
 			{
-				//      GetBus()->Open(E2Profile::GetPort());              //ormai obsoleta
 				return error;
 			}
-
-			if (GetBus()->ReadProgress((k + 1) * 100 / n_bank))
+		}
+		else
+		{
+			for (k = 0; k < n_bank; k++)
 			{
-				return OP_ABORTED;
+				if (sequential_read)
+				{
+					error = SequentialRead(eeprom_addr[k], &index, 1, GetBufPtr() + k * GetBankSize(), GetBankSize(), k * GetBankSize(), total);
+				}
+				else
+				{
+					error = bank_in(GetBufPtr() + k * GetBankSize(), k);
+				}
+
+				if (error)
+				{
+					//      GetBus()->Open(E2Profile::GetPort());              //ormai obsoleta
+					return error;
+				}
+
+				if (GetBus()->ReadProgress((k + 1) * 100 / n_bank))
+				{
+					return OP_ABORTED;
+				}
 			}
 		}
 	}
@@ -194,13 +441,31 @@ int E24xx::Verify(int type)
 		return BADPARAM;
 	}
 
-	unsigned char *localbuf = new unsigned char[GetBankSize()];
+	long total = (long)GetNoOfBank() * GetBankSize();
+	bool whole = (sequential_read && GetSeqReadChunk(total, GetBankSize()) == total);
+	unsigned char *localbuf = new unsigned char[whole ? total : GetBankSize()];
 
 	GetBus()->ReadStart();
 
 	int rval = 1;
 
-	if (type & PROG_TYPE)
+	if ((type & PROG_TYPE) && whole)
+	{
+		//tutta la memoria in una sola transazione
+		uint8_t index = 0;
+		int error = SequentialRead(eeprom_addr[0], &index, 1, localbuf, total, 0, total);
+
+		if (error)
+		{
+			rval = error;
+		}
+		else if (memcmp(GetBufPtr(), localbuf, total) != 0)
+		{
+			MapMismatches(0, localbuf, total, writepage_size);
+			rval = 0;
+		}
+	}
+	else if (type & PROG_TYPE)
 	{
 		// legge il contenuto attuale della EEPROM in memoria
 		int k;
@@ -209,17 +474,28 @@ int E24xx::Verify(int type)
 		{
 			int error;
 
-			if ((error = bank_in(localbuf, k)))
+			if (sequential_read)
+			{
+				uint8_t index = 0;
+				error = SequentialRead(eeprom_addr[k], &index, 1, localbuf, GetBankSize(), k * GetBankSize(), total);
+			}
+			else
+			{
+				error = bank_in(localbuf, k);
+			}
+
+			if (error)
 			{
 				//      GetBus()->Open(E2Profile::GetPort());
 				rval = error;
 				break;
 			}
 
+			//prosegue fino alla fine per costruire la mappa delle differenze
 			if (memcmp(GetBufPtr() + k * GetBankSize(), localbuf, GetBankSize()) != 0)
 			{
+				MapMismatches(k * GetBankSize(), localbuf, GetBankSize(), writepage_size);
 				rval = 0;
-				break;
 			}
 
 			if (GetBus()->ReadProgress((k + 1) * 100 / GetNoOfBank()))
@@ -235,13 +511,11 @@ int E24xx::Verify(int type)
 	return rval;
 }
 
-#define MAX_BANK_SIZE	256
-
 // questa routine si aspetta che in ingresso i 256 bytes da programmare l'eeprom
 // siano memorizzati nel iicbuffer nelle locazioni da 1 (non da 0!) a 256
 int E24xx::bank_out(uint8_t const *copy_buf, int bank, long size, long idx)
 {
-	int k, j;
+	int j;
 	uint8_t buffer[MAX_BANK_SIZE + 1];
 
 	if (size <= 0)
@@ -268,10 +542,7 @@ int E24xx::bank_out(uint8_t const *copy_buf, int bank, long size, long idx)
 			return GetBus()->Error();
 		}
 
-		for (k = timeout_loop; k > 0 && GetBus()->Read(eeprom_addr[bank], buffer, 1) != 1; k--)
-			;
-
-		if (k == 0)
+		if (WaitWriteCycle(eeprom_addr[bank]) != OK)
 		{
 			return E2P_TIMEOUT;
 		}
@@ -279,19 +550,32 @@ int E24xx::bank_out(uint8_t const *copy_buf, int bank, long size, long idx)
 
 #else
 
-	for (j = 0; j < size; j += writepage_size)
+	//le pagine non devono mai attraversare il limite del banco
+	int page_size = ((size % writepage_size) == 0) ? writepage_size : 1;
+
+	for (j = 0; j < size; j += page_size)
 	{
 		buffer[j] = j;
 
-		if (GetBus()->Write(eeprom_addr[bank], buffer + j, 1 + writepage_size) != (1 + writepage_size))
+		if (GetBus()->GetDiffWrite())
 		{
-			return GetBus()->Error();
+			uint8_t scratch[MAX_BANK_SIZE];
+
+			if (PageMatches(eeprom_addr[bank], buffer + j, 1, buffer + j + 1, page_size, scratch))
+			{
+				GetBus()->PageSkipped();
+				continue;
+			}
+
+			GetBus()->PageWritten();
 		}
 
-		for (k = timeout_loop; k > 0 && GetBus()->Read(eeprom_addr[bank], buffer, 1) != 1; k--)
-			;
+		if (GetBus()->Write(eeprom_addr[bank], buffer + j, 1 + page_size) != (1 + page_size))
+		{
+			return GetBus()->Error();
+		}
 
-		if (k == 0)
+		if (WaitWriteCycle(eeprom_addr[bank]) != OK)
 		{
 			return E2P_TIMEOUT;
 		}
@@ -353,8 +637,86 @@ int E24xx::bank_in(uint8_t *copy_buf, int bank, long size, long idx)
 	return OK;
 }
 
+//An ACK at the first slave address only tells the family, the size is
+//left to the 24XX Auto probe
+int E24xx::Identify(long &type, int &confidence)
+{
+	if (GetBus()->ProbeAck(base_addr))
+	{
+		type = E2400;
+		confidence = 50;
+		return OK;
+	}
+
+	confidence = 0;
+	return DEVICE_UNKNOWN;
+}
+
 #define CMP_LEN 16
 
+//true se il banco ha la stessa firma (inizio e fine) del banco 0
+bool E24xx::BankAliases(int bank, uint8_t const *sig)
+{
+	uint8_t buf[2 * CMP_LEN];
+
+	if (bank_in(buf, bank, CMP_LEN) || bank_in(buf + CMP_LEN, bank, CMP_LEN, GetBankSize() - CMP_LEN))
+	{
+		return false;
+	}
+
+	return memcmp(buf, sig, 2 * CMP_LEN) == 0;
+}
+
+//Dimensione reale (in banchi) cercata senza scrivere: se la EEPROM ha
+// N banchi (potenza di 2) il banco N e tutti i successivi multipli
+// replicano il banco 0, quelli prima no. Basta quindi una ricerca
+// binaria sulle potenze di 2, due letture di CMP_LEN byte per passo.
+// Con un contenuto uniforme (es. vuota) non si puo` dire nulla e si
+// tengono tutti i banchi che hanno risposto.
+int E24xx::AliasBankDetect(int nbank)
+{
+	uint8_t sig[2 * CMP_LEN];
+	int top, lo, hi, k;
+
+	if (bank_in(sig, 0, CMP_LEN) || bank_in(sig + CMP_LEN, 0, CMP_LEN, GetBankSize() - CMP_LEN))
+	{
+		return nbank;
+	}
+
+	for (k = 1; k < 2 * CMP_LEN && sig[k] == sig[0]; k++)
+		;
+
+	if (k == 2 * CMP_LEN)
+	{
+		return nbank;
+	}
+
+	for (top = 0; (2 << top) < nbank; top++)
+		;
+
+	//la prima potenza di 2 che replica il banco 0 in [2^lo, 2^hi)
+	lo = 0;
+	hi = top + 1;
+
+	while (lo < hi)
+	{
+		int mid = (lo + hi) / 2;
+
+		if (BankAliases(1 << mid, sig))
+		{
+			hi = mid;
+		}
+		else
+		{
+			lo = mid + 1;
+		}
+	}
+
+	qDebug() << "E24xx::AliasBankDetect(" << nbank << ") = " << ((lo <= top) ? (1 << lo) : nbank);
+
+	return (lo <= top) ? (1 << lo) : nbank;
+}
+
 //====================>>> E24xx::BankRollOverDetect <<<====================
 int E24xx::BankRollOverDetect(int force)
 {
@@ -447,12 +809,7 @@ int E24xx::BankRollOverDetect(int force)
 				return GetBus()->Error();
 			}
 
-			int k;
-
-			for (k = timeout_loop; k > 0 && GetBus()->Read(eeprom_addr[1], buf, 1) != 1; k--)
-				;
-
-			if (k == 0)
+			if (WaitWriteCycle(eeprom_addr[1]) != OK)
 			{
 				return E2P_TIMEOUT;
 			}
@@ -481,10 +838,7 @@ int E24xx::BankRollOverDetect(int force)
 				return GetBus()->Error();
 			}
 
-			for (k = timeout_loop; k > 0 && GetBus()->Read(eeprom_addr[1], buf, 1) != 1; k--)
-				;
-
-			if (k == 0)
+			if (WaitWriteCycle(eeprom_addr[1]) != OK)
 			{
 				return E2P_TIMEOUT;
 			}
@@ -45,14 +45,28 @@ class E24xx : public Device
 	int Read(int probe = 1, int type = ALL_TYPE);
 	int Write(int probe = 1, int type = ALL_TYPE);
 	int Verify(int type = ALL_TYPE);
+	int Repair(int retries);
 
 	int BankRollOverDetect(int force);
 
+	int Identify(long &type, int &confidence);
+
+	void ClearProbeCache()
+	{
+		Device::ClearProbeCache();
+		alias_nbank = -1;
+	}
+
+	long GetWriteCycleTime() const
+	{
+		return twr_estimate;
+	}
+
 	int     const max_bank;         // max number of banks (max eeprom size)
 
   protected:    //--------------------------------------- protected
 
-	int const timeout_loop;         //eeprom timeout
+	int const write_timeout;        //scadenza del ciclo di scrittura (msec)
 
 	//!!! 07/03/98
 	int base_addr;                          //eeprom I2C base address
@@ -68,9 +82,34 @@ class E24xx : public Device
 	virtual int bank_out(uint8_t const *copy_buf, int bank_no, long size = -1, long idx = 0);
 	virtual int bank_in(uint8_t *copy_buf, int bank_no, long size = -1, long idx = 0);
 
+	void SetupPageGeometry();
+	int SequentialRead(int addr, uint8_t const *index, int index_len, uint8_t *buf, long len,
+					   long progress_base, long progress_total, int lsb = 0);
+	long GetSeqReadChunk(long size, long def_size) const;
+
+	bool PageMatches(int addr, uint8_t const *index, int index_len, uint8_t const *data, int len, uint8_t *scratch);
+	bool IsWriteReady(int addr);
+	int WaitWriteCycle(int addr);
+	void RecordWriteCycle(long usec, bool early);
+
+	int AliasBankDetect(int nbank);
+	bool BankAliases(int bank, uint8_t const *sig);
+
 	//-- Parte riguardante la EEPROM
 	int sequential_read;                    //1 --> legge un banco in una volta
 	int writepage_size;                             //se > 1 scrive una pagina alla volta
+	int def_writepage_size;                 //usata se il tipo non specifica la pagina
+	long seqread_size;                              //max lettura sequenziale (0 --> non specificata)
+
+	//tempi del ciclo di scrittura (usec) misurati con l'ACK polling
+	long twr_estimate;                              //stima di tWR, 0 --> ancora sconosciuto
+	long twr_last;
+	long twr_max;
+
+	//dimensione trovata dall'aliasing (24XX Auto), valida finche` lo scan
+	// degli indirizzi I2C da` lo stesso numero di banchi
+	int alias_nbank;                                //-1 --> da determinare
+	int alias_acked;
 
   private:              //--------------------------------------- private
 
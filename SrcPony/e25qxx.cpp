@@ -0,0 +1,240 @@
+//=========================================================================//
+//                                                                         //
+//  PonyProg - Serial Device Programmer                                    //
+//                                                                         //
+//  Copyright (C) 1997-2017   Claudio Lanconelli                           //
+//                                                                         //
+//  http://ponyprog.sourceforge.net                                        //
+//                                                                         //
+//-------------------------------------------------------------------------//
+//                                                                         //
+// This program is free software; you can redistribute it and/or           //
+// modify it under the terms of the GNU  General Public License            //
+// as published by the Free Software Foundation; either version2 of        //
+// the License, or (at your option) any later version.                     //
+//                                                                         //
+// This program is distributed in the hope that it will be useful,         //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of          //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU       //
+// General Public License for more details.                                //
+//                                                                         //
+// You should have received a copy of the GNU  General Public License      //
+// along with this program (see LICENSE);     if not, write to the         //
+// Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. //
+//                                                                         //
+//=========================================================================//
+
+
+#include "types.h"
+#include "e25qxx.h"             // Header file
+#include "errcode.h"
+#include "eeptypes.h"
+#include "e2awinfo.h"
+#include "e2cmdw.h"
+
+#include <QDebug>
+
+//=====>>> Costruttore <<<======
+E25qxx::E25qxx(e2AppWinInfo *wininfo, BusIO *busp)
+	:       Device(wininfo, busp, 1 /*BANK_SIZE*/),
+			writepage_size(256)
+{
+}
+
+//--- Distruttore
+E25qxx::~E25qxx()
+{
+}
+
+//Pagina dalla tabella, 4 byte di indirizzo oltre 16MB
+void E25qxx::SetupGeometry()
+{
+	int page_size = GetEEPTypeWPageSize(GetAWInfo()->GetEEPId());
+
+	writepage_size = (page_size > 0) ? page_size : 256;
+
+	GetBus()->SetAddressBytes(GetSize() > MB(16) ? 4 : 3);
+	GetBus()->SetFlashSize(GetSize());
+}
+
+//JEDEC ID: il terzo byte e` la capacita` (1 << n byte), che e` anche
+// il sottotipo
+int E25qxx::QueryType(long &type)
+{
+	long id = GetBus()->ReadJedecId();
+
+	detected_type = type = 0;
+	detected_signature = "";
+
+	if (id < 0)
+	{
+		return DEVICE_UNKNOWN;
+	}
+
+	detected_signature.sprintf("%02lX-%02lX-%02lX", (id >> 16) & 0xFF, (id >> 8) & 0xFF, id & 0xFF);
+
+	long cap_type = ((long)E25QXX << 16) | (id & 0xFF);
+
+	//capacita` non in tabella (o codifica non JEDEC)
+	if (GetE2PSubType(cap_type) == 0 || GetEEPTypeSize(cap_type) <= 0)
+	{
+		return DEVICE_UNKNOWN;
+	}
+
+	detected_type = type = cap_type;
+
+	return OK;
+}
+
+int E25qxx::Identify(long &type, int &confidence)
+{
+	int rv = QueryType(type);
+
+	//l'ID dice la capacita`, non il modello esatto
+	confidence = (rv == OK) ? 90 : 0;
+
+	return rv;
+}
+
+// determina la dimensione della flash con il JEDEC ID
+//---
+int E25qxx::Probe(int probe_size)
+{
+	long type;
+	int rv = QueryTypeCached(type);
+
+	qDebug() << "E25qxx::Probe(" << probe_size << ") type " << (hex) << type << (dec);
+
+	if (rv == OK)
+	{
+		if (probe_size || GetE2PSubType(GetAWInfo()->GetEEPId()) == 0)
+		{
+			SetNoOfBank(GetEEPTypeSize(type));
+		}
+		else if (GetE2PSubType(GetAWInfo()->GetEEPId()) != GetE2PSubType(type) && !cmdWin->GetIgnoreFlag())
+		{
+			rv = DEVICE_BADTYPE;
+		}
+	}
+	else if (cmdWin->GetIgnoreFlag())
+	{
+		rv = OK;
+	}
+
+	if (rv == OK)
+	{
+		SetupGeometry();
+		rv = GetSize();
+	}
+
+	return rv;
+}
+
+int E25qxx::Read(int probe, int type)
+{
+	int rv = Probe(probe || GetNoOfBank() == 0);
+
+	if (rv > 0 && (type & PROG_TYPE))
+	{
+		long size = GetSize();
+		long len = GetBus()->Read(0, GetBufPtr(), size);
+
+		if (len != size)
+		{
+			rv = (len > 0) ? OP_ABORTED : (int)len;
+		}
+	}
+
+	return rv;
+}
+
+int E25qxx::Write(int probe, int type)
+{
+	int rv = Probe(probe || GetNoOfBank() == 0);
+
+	if (rv > 0 && (type & PROG_TYPE))
+	{
+		long size = GetSize();
+		long len;
+
+		GetBus()->ClearLastProgrammedAddress();
+		len = GetBus()->Write(0, GetBufPtr(), size, writepage_size);
+
+		qDebug() << "E25qxx::Write() pages programmed " << GetBus()->GetPagesWritten() << ", skipped " << GetBus()->GetPagesSkipped();
+
+		if (len != size)
+		{
+			rv = (len > 0) ? OP_ABORTED : (int)len;
+		}
+	}
+
+	return rv;
+}
+
+//Legge solo fino all'ultimo byte programmato: oltre e` tutto cancellato
+int E25qxx::Verify(int type)
+{
+	if (GetSize() == 0)
+	{
+		return BADPARAM;
+	}
+
+	int rval = 1;
+
+	if (type & PROG_TYPE)
+	{
+		long size = GetSize();
+		long v_len = size;
+		long last = GetBus()->GetLastProgrammedAddress();
+		uint8_t *localbuf = new uint8_t[size];
+
+		if (last > 0 && last < size)
+		{
+			v_len = last + 1;
+			GetBus()->ClearLastProgrammedAddress();
+		}
+
+		memset(localbuf, 0xFF, size);
+
+		long len = GetBus()->Read(0, localbuf, v_len);
+
+		if (len != v_len)
+		{
+			rval = (len > 0) ? OP_ABORTED : (int)len;
+		}
+		else if (memcmp(GetBufPtr(), localbuf, size) != 0)
+		{
+			MapMismatches(0, localbuf, size, writepage_size);
+			rval = 0;
+		}
+
+		delete[] localbuf;
+	}
+
+	return rval;
+}
+
+int E25qxx::Erase(int probe, int type)
+{
+	int rv = Probe(probe || GetNoOfBank() == 0);
+
+	if (rv > 0)
+	{
+		rv = GetBus()->Erase(type);
+	}
+
+	return rv;
+}
+
+//Una flash vuota non ha bisogno di cancellazione prima della scrittura
+int E25qxx::BlankCheck(int type)
+{
+	int rv = Device::BlankCheck(type);
+
+	if (rv == OK)
+	{
+		GetBus()->SetErased();
+	}
+
+	return rv;
+}
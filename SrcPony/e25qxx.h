@@ -0,0 +1,73 @@
+//=========================================================================//
+//                                                                         //
+//  PonyProg - Serial Device Programmer                                    //
+//                                                                         //
+//  Copyright (C) 1997-2017   Claudio Lanconelli                           //
+//                                                                         //
+//  http://ponyprog.sourceforge.net                                        //
+//                                                                         //
+//-------------------------------------------------------------------------//
+//                                                                         //
+// This program is free software; you can redistribute it and/or           //
+// modify it under the terms of the GNU  General Public License            //
+// as published by the Free Software Foundation; either version2 of        //
+// the License, or (at your option) any later version.                     //
+//                                                                         //
+// This program is distributed in the hope that it will be useful,         //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of          //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU       //
+// General Public License for more details.                                //
+//                                                                         //
+// You should have received a copy of the GNU  General Public License      //
+// along with this program (see LICENSE);     if not, write to the         //
+// Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. //
+//                                                                         //
+//=========================================================================//
+
+
+#ifndef _E25QXX_H
+#define _E25QXX_H
+
+#include "types.h"
+
+#include "device.h"
+#include "spiflashbus.h"
+
+
+class E25qxx : public Device
+{
+  public:               //---------------------------------------- public
+
+	E25qxx(e2AppWinInfo *wininfo = 0, BusIO *busp = 0);
+	virtual ~E25qxx();
+
+	int Probe(int probe_size = 0);
+	int Read(int probe = 1, int type = ALL_TYPE);
+	int Write(int probe = 1, int type = ALL_TYPE);
+	int Verify(int type = ALL_TYPE);
+	int Erase(int probe = 1, int type = ALL_TYPE);
+	int BlankCheck(int type = ALL_TYPE);
+
+	bool CanInlineVerify(int type) const
+	{
+		(void)type;
+		return true;
+	}
+
+	int Identify(long &type, int &confidence);
+
+  protected:    //--------------------------------------- protected
+
+	SpiFlashBus *GetBus()
+	{
+		return static_cast<SpiFlashBus *>(Device::GetBus());
+	}
+
+	int QueryType(long &type);
+	void SetupGeometry();
+
+  private:              //--------------------------------------- private
+
+	int writepage_size;
+};
+#endif
@@ -46,7 +46,9 @@
 //=========================>>> e2App::e2App <<<==========================
 e2App::e2App() :
 	awip(0),
-	port_number(0)
+	port_number(0),
+	bus_session(false),
+	bus_powered(false)
 {
 	// Constructor
 	qDebug() << "e2App::e2App()";
@@ -83,6 +85,7 @@ e2App::e2App() :
 	busvetp[IMBUS - 1] = &imB;
 	busvetp[X2444B - 1] = &x2444B;
 	busvetp[S2430B - 1] = &s2430B;
+	busvetp[SPIFLASHB - 1] = &spiFlashB;
 
 	SetInterfaceType();     //Set default interface
 
@@ -221,6 +224,7 @@ void e2App::ClosePort()
 {
 	qDebug() << "e2App::ClosePort() iniBus=" << (hex) << iniBus << (dec);
 	iniBus->Close();
+	bus_powered = false;
 }
 
 //=====================>>> e2App::TestPort <<<==============================
@@ -242,7 +246,17 @@ int e2App::OpenBus(BusIO *p)
 {
 	qDebug() << "e2App::OpenBus(" << (hex) << p << (dec) << ")";
 
+	//Same device still powered: skip the power cycle and the power up delay
+	if (bus_session && bus_powered && p == iniBus)
+	{
+		qDebug() << "e2App::OpenBus() ** Session, Reset only";
+
+		iniBus->Reset();
+		return OK;
+	}
+
 	iniBus->Close();
+	bus_powered = false;
 
 	qDebug() << "e2App::OpenBus() ** Close";
 
@@ -263,6 +277,8 @@ int e2App::OpenBus(BusIO *p)
 		qDebug() << "e2App::OpenBus() ** Reset";
 
 		iniBus->Reset();        //28/10/98
+
+		bus_powered = true;
 	}
 
 	qDebug() << "e2App::OpenBus() = " << rv;
@@ -275,9 +291,36 @@ void e2App::SleepBus()
 {
 	qDebug() << "e2App::CloseBus() iniBus=" << (hex) << iniBus << (dec);
 
+	if (bus_session)
+	{
+		return;         //the power goes off at EndSession()
+	}
+
 	iniBus->WaitMsec(5);    // 08/04/98 -- hold time dell'alimentazione
 	busIntp->SetPower(false);
 	iniBus->Close();                // 28/09/98 -- richiude la porta dopo averla usata
+	bus_powered = false;
+}
+
+//=====================>>> e2App::BeginSession <<<==============================
+void e2App::BeginSession()
+{
+	qDebug() << "e2App::BeginSession()";
+
+	bus_session = true;
+}
+
+//=====================>>> e2App::EndSession <<<==============================
+void e2App::EndSession()
+{
+	qDebug() << "e2App::EndSession() powered=" << bus_powered;
+
+	bus_session = false;
+
+	if (bus_powered)
+	{
+		SleepBus();
+	}
 }
 
 
@@ -380,6 +423,9 @@ void e2App::KeyIn(vWindow *win, vKey key, unsigned int shift)
 //=======================>>> e2App::SetInterface <<<=========================
 void e2App::SetInterfaceType(HInterfaceType type)
 {
+	//A different interface means a different socket
+	EndSession();
+
 	switch (type)
 	{
 	//Interface initializers
@@ -50,6 +50,7 @@
 #include "picbusnew.h"
 #include "imbus.h"
 #include "x2444bus.h"
+#include "spiflashbus.h"
 
 //Include Interface Classes
 #include "pgminter.h"
@@ -114,6 +115,11 @@ class e2App : public cTranslator
 	int OpenBus(BusIO *p);
 	void SleepBus();
 
+	//Inside a session the power stays on between operations on the same
+	// bus: OpenBus() only resets the device, SleepBus() does nothing.
+	void BeginSession();
+	void EndSession();
+
 
 	void SetInterfaceType(HInterfaceType type = SIPROG_API);
 	HInterfaceType GetInterfaceType() const
@@ -210,6 +216,9 @@ class e2App : public cTranslator
 
 	int port_number;        //port number used
 	BusIO *iniBus;                           //pointer to current Bus
+
+	bool bus_session;       //keep the power on between operations
+	bool bus_powered;       //iniBus is open and powered
 	BusIO *busvetp[NO_OF_BUSTYPE];  //array of pointers to available Bus
 	//AutoTag
 	//List of available bus types
@@ -229,6 +238,7 @@ class e2App : public cTranslator
 	IMBus imB;
 	X2444Bus x2444B;
 	X2444Bus s2430B;
+	SpiFlashBus spiFlashB;
 
 	QString helpfile;
 	QString ok_soundfile;
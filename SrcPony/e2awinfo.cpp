@@ -35,6 +35,7 @@
 #include <QMessageBox>
 #include <QString>
 #include <QDebug>
+#include <QElapsedTimer>
 
 
 //======================>>> e2AppWinInfo::e2AppWinInfo <<<=======================
@@ -48,6 +49,7 @@ e2AppWinInfo::e2AppWinInfo(e2CmdWindow *p, const QString &name, BusIO **busvptr)
 	buf_ok(false),
 	buf_changed(false),
 	//              fname(0),
+	block_size(1),
 	no_block(0),
 	splitted(0),
 	roll_over(0),
@@ -59,6 +61,8 @@ e2AppWinInfo::e2AppWinInfo(e2CmdWindow *p, const QString &name, BusIO **busvptr)
 	qDebug() << "e2AppWinInfo::e2AppWinInfo()";
 
 	// Constructor
+	buffer = new uint8_t[buffer_size];
+	memset(buffer, 0xFF, buffer_size);
 //	cmdWin = static_cast<e2CmdWindow*>(p);
 
 	fname = "";
@@ -80,6 +84,7 @@ e2AppWinInfo::e2AppWinInfo(e2CmdWindow *p, const QString &name, BusIO **busvptr)
 	eepPic16 = new Pic16xx(this, busvptr[PICB - 1]);
 	eep250xx = new At250xx(this, busvptr[AT250 - 1]);
 	eep25xxx = new At25xxx(this, busvptr[AT250BIG - 1]);
+	eep25qxx = new E25qxx(this, busvptr[SPIFLASHB - 1]);
 	eep2506 = new Sde2506(this, busvptr[SDEB - 1]);
 	eepPic168xx = new Pic168xx(this, busvptr[PICNEWB - 1]);
 	eep3060 = new Nvm3060(this, busvptr[IMBUS - 1]);
@@ -237,6 +242,38 @@ e2AppWinInfo::~e2AppWinInfo()
 
 	// Destructor
 	fname = "";
+
+	delete[] buffer;
+}
+
+void e2AppWinInfo::SetNoOfBlock(int blk)
+{
+	no_block = blk;
+	GrowBuffer((long)no_block * block_size);
+}
+
+void e2AppWinInfo::SetBlockSize(int blk)
+{
+	block_size = blk;
+	GrowBuffer((long)no_block * block_size);
+}
+
+//Le flash SPI superano BUFFER_SIZE: il buffer cresce e non si riduce
+// piu`, cosi` i puntatori ottenuti da GetBufPtr() restano validi
+// finche` si resta sullo stesso tipo di device
+void e2AppWinInfo::GrowBuffer(long size)
+{
+	if (size > buffer_size)
+	{
+		uint8_t *newbuf = new uint8_t[size];
+
+		memcpy(newbuf, buffer, buffer_size);
+		memset(newbuf + buffer_size, 0xFF, size - buffer_size);
+
+		delete[] buffer;
+		buffer = newbuf;
+		buffer_size = size;
+	}
 }
 
 
@@ -359,9 +396,12 @@ void e2AppWinInfo::SetEEProm(unsigned long id)
 
 		long xtype = GetEEPId();
 		eep->SetProgPageSize(GetEEPTypeWPageSize(xtype), false);
+		eep->SetDataPageSize(GetEEPTypeEEPPageSize(xtype), false);
 		At90sBus *b = static_cast<At90sBus *>(eep->GetBus());
 		b->SetFlashPagePolling((xtype != ATmega603) && (xtype != ATmega103));
 		b->SetOld1200Mode((xtype == AT90S1200));
+		//Parts with EEPROM page mode all implement Poll RDY/BSY
+		b->SetRdyBsyPolling(GetEEPTypeEEPPageSize(xtype) > 0);
 		break;
 	}
 
@@ -402,6 +442,7 @@ void e2AppWinInfo::SetEEProm(unsigned long id)
 			eep_subtype = GetE2PSubType(E9306);
 		}
 
+		eep->GetBus()->SetSeqRead(GetEEPTypeSeqReadSize(GetEEPId()) >= 0);
 		break;
 
 	case E93XX_8:
@@ -413,6 +454,7 @@ void e2AppWinInfo::SetEEProm(unsigned long id)
 			eep_subtype = GetE2PSubType(E9306_8);
 		}
 
+		eep->GetBus()->SetSeqRead(GetEEPTypeSeqReadSize(GetEEPId()) >= 0);
 		break;
 
 	case PIC16XX:
@@ -454,6 +496,7 @@ void e2AppWinInfo::SetEEProm(unsigned long id)
 			eep_subtype = GetE2PSubType(E25010);
 		}
 
+		eep->GetBus()->SetSeqRead(GetEEPTypeSeqReadSize(GetEEPId()) >= 0);
 		break;
 
 	case E25XXX:
@@ -468,6 +511,11 @@ void e2AppWinInfo::SetEEProm(unsigned long id)
 		//eep->SetBus(GetBusVectorPtr()[AT250BIG-1]);
 		break;
 
+	case E25QXX:
+		//subtype 0 (Auto): la dimensione viene letta dal JEDEC ID
+		eep = eep25qxx;
+		break;
+
 	case E2506XX:
 		eep = eep2506;
 
@@ -603,12 +651,12 @@ int e2AppWinInfo::Read(int type, int raise_power, int leave_on)
 }
 
 //======================>>> e2AppWinInfo::Write <<<=======================
-int e2AppWinInfo::Write(int type, int raise_power, int leave_on)
+int e2AppWinInfo::Write(int type, int raise_power, int leave_on, bool inline_verify)
 {
 	int probe = !GetE2PSubType(eep_id);
 	int rval = OK;
 
-	qDebug() << "e2AppWinInfo::Write(" << type << "," << raise_power << "," << leave_on << ") - IN";
+	qDebug() << "e2AppWinInfo::Write(" << type << "," << raise_power << "," << leave_on << "," << inline_verify << ") - IN";
 
 	if (raise_power)
 	{
@@ -619,6 +667,18 @@ int e2AppWinInfo::Write(int type, int raise_power, int leave_on)
 	{
 		//              CheckEvents();
 
+		eep->GetBus()->SetDiffWrite(E2Profile::GetDiffWrite());
+		eep->GetBus()->SetInlineVerify(inline_verify);
+
+		//il report di un verify inline fallito non deve mostrare le
+		// differenze di un Verify() precedente
+		eep->ClearMismatchMap();
+
+		if (type & (PROG_TYPE | DATA_TYPE))
+		{
+			eep->GetBus()->ClearPageStats();
+		}
+
 		if ((rval = eep->Write(probe, type)) > 0)
 		{
 			//Aggiunto il 18/03/99 con la determinazione dei numeri di banchi nelle E24xx2,
@@ -633,6 +693,11 @@ int e2AppWinInfo::Write(int type, int raise_power, int leave_on)
 		}
 	}
 
+	if (eep->GetBus()->GetDiffWrite())
+	{
+		qDebug() << "e2AppWinInfo::Write() pages written" << eep->GetBus()->GetPagesWritten() << ", skipped" << eep->GetBus()->GetPagesSkipped();
+	}
+
 	qDebug() << "e2AppWinInfo::Write() = " << rval << " - OUT";
 
 	return rval;
@@ -652,6 +717,7 @@ int e2AppWinInfo::Verify(int type, int raise_power, int leave_on)
 
 	if (rval == OK)
 	{
+		eep->ClearMismatchMap();
 		rval = eep->Verify(type);
 
 		if (!(rval >= 0 && leave_on))
@@ -665,6 +731,119 @@ int e2AppWinInfo::Verify(int type, int raise_power, int leave_on)
 	return rval;
 }
 
+//======================>>> e2AppWinInfo::Repair <<<=======================
+int e2AppWinInfo::Repair(int retries)
+{
+	int rval;
+
+	qDebug() << "e2AppWinInfo::Repair(" << retries << ") - IN";
+
+	if ((rval = OpenBus()) == OK)
+	{
+		rval = eep->Repair(retries);
+		SleepBus();
+	}
+
+	qDebug() << "e2AppWinInfo::Repair() = " << rval << " - OUT";
+
+	return rval;
+}
+
+//Riassunto della mappa delle differenze dell'ultimo Verify
+QString e2AppWinInfo::GetMismatchReport() const
+{
+	QString rep;
+	QVector<VerifyMismatch> const &map = eep->GetMismatchMap();
+	int k;
+
+	for (k = 0; k < map.size() && k < 8; k++)
+	{
+		rep += QString("\nPage %1 at 0x%2: 0x%3-0x%4, %5 bytes")
+			   .arg(map[k].page)
+			   .arg(map[k].addr, 0, 16)
+			   .arg(map[k].first, 0, 16)
+			   .arg(map[k].last, 0, 16)
+			   .arg(map[k].count);
+	}
+
+	if (map.size() > 8)
+	{
+		rep += QString("\n... %1 pages").arg(map.size());
+	}
+
+	return rep;
+}
+
+//Verify durante la scrittura, pagina per pagina
+bool e2AppWinInfo::CanInlineVerify(int type) const
+{
+	return E2Profile::GetInlineVerify() && eep->CanInlineVerify(type);
+}
+
+//Indirizzo della prima differenza trovata dal verify durante la scrittura
+QString e2AppWinInfo::GetVerifyFailReport() const
+{
+	QString rep;
+	long addr = eep->GetBus()->GetVerifyFailAddress();
+
+	if (addr >= 0)
+	{
+		rep = QString("\nAddress 0x%1").arg(addr, 0, 16);
+	}
+
+	return rep;
+}
+
+//Pagine scritte e saltate dall'ultima scrittura differenziale,
+// stringa vuota se non e` attiva
+QString e2AppWinInfo::GetDiffReport() const
+{
+	QString rep;
+	BusIO *b = eep->GetBus();
+
+	if (b->GetDiffWrite() && (b->GetPagesWritten() + b->GetPagesSkipped()) > 0)
+	{
+		rep = QString("\n%1 written, %2 unchanged").arg(b->GetPagesWritten()).arg(b->GetPagesSkipped());
+	}
+
+	return rep;
+}
+
+//Campi di configurazione (fuse, lock, config word) scritti o lasciati
+// invariati nel job corrente, stringa vuota se non ce ne sono
+QString e2AppWinInfo::GetConfigReport() const
+{
+	QString rep;
+
+	foreach (ConfigFieldResult const &res, eep->GetConfigReport())
+	{
+		rep += QString("\n%1: %2").arg(res.field).arg(res.changed ? "written" : "unchanged");
+	}
+
+	return rep;
+}
+
+//Esito per ogni EEPROM dell'ultima scrittura/verifica in gang mode,
+// stringa vuota se non e` attivo
+QString e2AppWinInfo::GetGangReport() const
+{
+	QString rep;
+
+	if (eep == eep24xx2 && eep24xx2->GetGangCount() > 1 && E2Profile::GetI2CGangMode())
+	{
+		int k;
+
+		for (k = 0; k < eep24xx2->GetGangCount(); k++)
+		{
+			rep += QString("\n0x%1: %2")
+				   .arg(eep24xx2->GetGangAddress(k), 2, 16, QChar('0'))
+				   .arg(eep24xx2->GetGangResult(k) == OK ? "OK" : QString::number(eep24xx2->GetGangResult(k)));
+		}
+	}
+
+	return rep;
+}
+
 //======================>>> e2AppWinInfo::Erase <<<=======================
 int e2AppWinInfo::Erase(int type, int raise_power, int leave_on)
 {
@@ -692,6 +871,112 @@ int e2AppWinInfo::Erase(int type, int raise_power, int leave_on)
 	return rval;
 }
 
+//======================>>> e2AppWinInfo::BlankCheck <<<=======================
+int e2AppWinInfo::BlankCheck(int type, int raise_power, int leave_on)
+{
+	int rval = OK;
+
+	qDebug() << "e2AppWinInfo::BlankCheck(" << type << "," << raise_power << "," << leave_on << ") - IN";
+
+	if (raise_power)
+	{
+		rval = OpenBus();
+	}
+
+	if (rval == OK)
+	{
+		rval = eep->BlankCheck(type);
+
+		if (!(rval >= 0 && leave_on))
+		{
+			SleepBus();
+		}
+	}
+
+	qDebug() << "e2AppWinInfo::BlankCheck() = " << rval << " - OUT";
+
+	return rval;
+}
+
+//Primo indirizzo non vuoto trovato dall'ultimo BlankCheck
+QString e2AppWinInfo::GetBlankCheckReport() const
+{
+	QString rep;
+	long addr = eep->GetBlankCheckAddress();
+
+	if (addr >= 0)
+	{
+		rep = QString("\nAddress 0x%1").arg(addr, 0, 16);
+	}
+
+	return rep;
+}
+
+//Forget the sizes detected in the previous job, the part may have changed
+void e2AppWinInfo::ClearProbeCache()
+{
+	eep->ClearProbeCache();
+}
+
+void e2AppWinInfo::ClearConfigReport()
+{
+	eep->ClearConfigReport();
+}
+
+//Try the device families from the cheapest probe (I2C ACK) to the
+// slowest (PIC device ID), stop on an exact ID or when out of time.
+// The PIC probe raises Vpp, so it runs only with the JDM interface.
+int e2AppWinInfo::AutoIdentify(long &type, int &confidence, long budget_ms)
+{
+	Device *probe_list[] =
+	{
+		eep24xx, eep25qxx, eep25xxx, eepAt90s, eepAt89s, eepPic168xx
+	};
+	int n_probe = sizeof(probe_list) / sizeof(probe_list[0]);
+	QElapsedTimer timer;
+	int k;
+
+	qDebug() << "e2AppWinInfo::AutoIdentify(" << budget_ms << ") - IN";
+
+	type = 0;
+	confidence = 0;
+	timer.start();
+
+	for (k = 0; k < n_probe && confidence < 100; k++)
+	{
+		Device *dev = probe_list[k];
+
+		if (dev == eepPic168xx && cmdWin->GetInterfaceType() != JDM_API)
+		{
+			continue;
+		}
+
+		if (timer.hasExpired(budget_ms))
+		{
+			qDebug() << "e2AppWinInfo::AutoIdentify() time budget expired";
+			break;
+		}
+
+		if (cmdWin->OpenBus(dev->GetBus()) == OK)
+		{
+			long t = 0;
+			int c = 0;
+
+			if (dev->Identify(t, c) == OK && c > confidence)
+			{
+				type = t;
+				confidence = c;
+			}
+
+			SleepBus();
+		}
+	}
+
+	qDebug() << "e2AppWinInfo::AutoIdentify() = " << (hex) << type << (dec) << " (" << confidence << "%) in " << timer.elapsed() << "ms - OUT";
+
+	return confidence > 0 ? OK : DEVICE_UNKNOWN;
+}
+
 //===================>>> e2AppWinInfo::BankRollOverDetect <<<=============
 int e2AppWinInfo::BankRollOverDetect(int force)
 {
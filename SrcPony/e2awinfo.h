@@ -54,6 +54,7 @@
 #include "pic125xx.h"
 #include "at250xx.h"
 #include "at25xxx.h"
+#include "e25qxx.h"
 #include "sde2506.h"
 #include "nvm3060.h"
 #include "at17xxx.h"
@@ -92,10 +93,21 @@ class e2AppWinInfo // : public QObject
 	~e2AppWinInfo();
 
 	int Read(int type = ALL_TYPE, int raise_power = true, int leave_on = false);
-	int Write(int type = ALL_TYPE, int raise_power = true, int leave_on = false);
+	int Write(int type = ALL_TYPE, int raise_power = true, int leave_on = false, bool inline_verify = false);
+	bool CanInlineVerify(int type) const;
+	QString GetVerifyFailReport() const;
+	int Repair(int retries);
+	QString GetMismatchReport() const;
 	int Verify(int type = ALL_TYPE, int raise_power = true, int leave_on = false);
+	QString GetGangReport() const;
+	QString GetDiffReport() const;
+	QString GetConfigReport() const;
 	int Erase(int type = ALL_TYPE, int raise_power = true, int leave_on = false);
-	//      int BlankCheck(int type = ALL_TYPE, int raise_power = true, int leave_on = false);
+	int BlankCheck(int type = ALL_TYPE, int raise_power = true, int leave_on = false);
+	QString GetBlankCheckReport() const;
+	int AutoIdentify(long &type, int &confidence, long budget_ms = 2000);
+	void ClearProbeCache();
+	void ClearConfigReport();
 
 	//      int Load(int bank = 0);
 	int Load();
@@ -107,10 +119,7 @@ class e2AppWinInfo // : public QObject
 	{
 		return no_block;
 	}
-	void SetNoOfBlock(int blk)
-	{
-		no_block = blk;
-	}
+	void SetNoOfBlock(int blk);
 	int GetBlockSize() const
 	{
 		return block_size;
@@ -281,16 +290,14 @@ class e2AppWinInfo // : public QObject
   private:              //--------------------------------------- private
 	int OpenBus();
 	void SleepBus();
-	void SetBlockSize(int blk)
-	{
-		block_size = blk;
-	}
+	void SetBlockSize(int blk);
+	void GrowBuffer(long size);
 	int LoadFile();
 
 	QString fname;                            //nome del file
 
 	int const hex_per_line;
-	int const buffer_size;
+	int buffer_size;
 
 	int load_type;                          //load ALL, Flash only or EEPROM only
 	int save_type;                          //save ALL, Flash only or EEPROM only
@@ -303,7 +310,7 @@ class e2AppWinInfo // : public QObject
 
 	// EK 2017
 	// TODO convert to QByteArray or QBuffer?
-	uint8_t buffer[BUFFER_SIZE];    //device content buffer
+	uint8_t *buffer;                //device content buffer (almeno BUFFER_SIZE, cresce con il device)
 	QString linebuf;//[LINEBUF_SIZE];     //print line buffer
 	bool buf_ok;                            //true if buffer is valid
 	bool buf_changed;                       //true if buffer changed/edited
@@ -348,6 +355,7 @@ class e2AppWinInfo // : public QObject
 	Pic125xx *eepPic125xx;
 	At250xx *eep250xx;
 	At25xxx *eep25xxx;
+	E25qxx *eep25qxx;
 	Sde2506 *eep2506;
 	Nvm3060 *eep3060;
 	At17xxx *eep17xxx;
@@ -54,6 +54,7 @@
 #include "aboutmdlg.h"
 #include "filldlg.h"
 #include "fusemdlg.h"
+#include "fusedb.h"
 #include "blockmdlg.h"
 #include "progoption.h"
 #include "sernumdlg.h"
@@ -1110,7 +1111,7 @@ void e2CmdWindow::addSPIStruct()
 
 	mTmp->mnu = new QMenu("SPI eeprom");
 	mTmp->grp = new QActionGroup(this);
-	mTmp->type << E250XX << E25XXX;
+	mTmp->type << E250XX << E25XXX << E25QXX;
 
 	initMenuVector(mTmp);
 
@@ -2940,6 +2941,8 @@ int e2CmdWindow::CmdWrite(int type, bool verify)
 		{
 			int rval;
 			int retry_flag = 1;
+			//read back each page while writing, no separate verify pass
+			bool inline_verify = verify && awip->CanInlineVerify(type);
 
 			UpdateBuffer();
 			ClearIgnoreFlag();
@@ -2952,18 +2955,25 @@ int e2CmdWindow::CmdWrite(int type, bool verify)
 
 				doProgress(translate(STR_MSGWRITING));
 
-				rval = awip->Write(type, true, verify ? true : false);
+				rval = awip->Write(type, true, verify ? true : false, inline_verify);
 
-				if (rval > 0)
+				if (rval > 0 || rval == E2ERR_VERIFYFAILED)
 				{
-					if (verify)
+					if (rval == E2ERR_VERIFYFAILED)
+					{
+						rval = 0;       //inline verify failed, the bus is already off
+					}
+					else if (verify)
 					{
 						doProgress(translate(STR_MSGVERIFING));
 
 						if ((old_type & CONFIG_TYPE) &&
 								!(awip->GetFuseBits() == 0 && awip->GetLockBits() == 0))
 						{
-							rval = awip->Verify(type, false, true);
+							if (!inline_verify)
+							{
+								rval = awip->Verify(type, false, true);
+							}
 
 							if (rval > 0)
 							{
@@ -2976,9 +2986,22 @@ int e2CmdWindow::CmdWrite(int type, bool verify)
 								}
 							}
 						}
+						else if (inline_verify)
+						{
+							SleepBus();
+						}
 						else
 						{
 							rval = awip->Verify(type, false, false);
+
+							//reprogram only the pages that failed the verify
+							if (rval == 0 && E2Profile::GetRepairRetries() > 0)
+							{
+								if (awip->Repair(E2Profile::GetRepairRetries()) > 0)
+								{
+									rval = 1;
+								}
+							}
 						}
 					}
 
@@ -3009,7 +3032,7 @@ int e2CmdWindow::CmdWrite(int type, bool verify)
 
 						if (verbose == verboseAll)
 						{
-							QMessageBox note(QMessageBox::Information, "Write", translate(STR_MSGWRITEOK), QMessageBox::Close);
+							QMessageBox note(QMessageBox::Information, "Write", translate(STR_MSGWRITEOK) + awip->GetDiffReport() + awip->GetConfigReport() + awip->GetGangReport(), QMessageBox::Close);
 							note.setStyleSheet(programStyleSheet);
 							note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
 //
@@ -3020,7 +3043,7 @@ int e2CmdWindow::CmdWrite(int type, bool verify)
 					{
 						if (verbose != verboseNo)
 						{
-							QMessageBox note(QMessageBox::Warning, "Write", translate(STR_MSGWRITEFAIL), QMessageBox::Close);
+							QMessageBox note(QMessageBox::Warning, "Write", translate(STR_MSGWRITEFAIL) + awip->GetVerifyFailReport() + awip->GetMismatchReport() + awip->GetGangReport(), QMessageBox::Close);
 							note.setStyleSheet(programStyleSheet);
 							note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
 //
@@ -3047,7 +3070,7 @@ int e2CmdWindow::CmdWrite(int type, bool verify)
 
 					if (verbose != verboseNo)
 					{
-						rval = OnError(rval, translate(STR_MSGWRITEFAIL));
+						rval = OnError(rval, translate(STR_MSGWRITEFAIL) + awip->GetGangReport());
 
 						if (rval == QMessageBox::Abort)   //Abort
 						{
@@ -3266,6 +3289,86 @@ int e2CmdWindow::CmdErase(int type)
 	return result;
 }
 
+//====================>>> e2CmdWindow::CmdBlankCheck <<<====================
+int e2CmdWindow::CmdBlankCheck(int type)
+{
+	int result;
+
+	doProgress(translate(STR_MSGREADING));
+
+	result = awip->BlankCheck(type);
+	e2Prg->reset();
+
+	if (result == OK)
+	{
+		if (verbose == verboseAll)
+		{
+			QMessageBox note(QMessageBox::Information, "Blank check", translate(STR_MSGBLANKOK), QMessageBox::Close);
+			note.setStyleSheet(programStyleSheet);
+			note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
+			note.exec();
+		}
+	}
+	else if (result == E2ERR_BLANKCHECKFAILED)
+	{
+		if (verbose != verboseNo)
+		{
+			QMessageBox note(QMessageBox::Critical, "Blank check", translate(STR_BLANKCHECKERR) + awip->GetBlankCheckReport(), QMessageBox::Close);
+			note.setStyleSheet(programStyleSheet);
+			note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
+			note.exec();
+		}
+	}
+	else
+	{
+		if (verbose != verboseNo)
+		{
+			OnError(result);
+		}
+	}
+
+	return result;
+}
+
+//====================>>> e2CmdWindow::CmdAutoIdentify <<<====================
+int e2CmdWindow::CmdAutoIdentify()
+{
+	long type;
+	int confidence;
+	int result;
+
+	doProgress(translate(STR_MSGREADING));
+
+	result = awip->AutoIdentify(type, confidence);
+	e2Prg->reset();
+
+	if (result == OK)
+	{
+		//Family level results (24XX, 25XXX) are only reported
+		if (confidence >= 50)
+		{
+			CmdSelectDevice(type);
+		}
+
+		if (verbose == verboseAll)
+		{
+			QMessageBox note(QMessageBox::Information, "Auto identify", translate(STR_MSGIDENTIFIED).arg(GetEEPTypeString(type)).arg(confidence), QMessageBox::Close);
+			note.setStyleSheet(programStyleSheet);
+			note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
+			note.exec();
+		}
+	}
+	else
+	{
+		if (verbose != verboseNo)
+		{
+			OnError(result);
+		}
+	}
+
+	return result;
+}
+
 //====================>>> e2CmdWindow::CmdVerify <<<====================
 int e2CmdWindow::CmdVerify(int type)
 {
@@ -3305,7 +3408,7 @@ int e2CmdWindow::CmdVerify(int type)
 
 			if (verbose != verboseNo)
 			{
-				QMessageBox note(QMessageBox::Critical, "Verify", translate(STR_MSGVERIFYFAIL2), QMessageBox::Close);
+				QMessageBox note(QMessageBox::Critical, "Verify", translate(STR_MSGVERIFYFAIL2) + awip->GetMismatchReport() + awip->GetGangReport(), QMessageBox::Close);
 				note.setStyleSheet(programStyleSheet);
 				note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
 				note.exec();
@@ -3317,7 +3420,7 @@ int e2CmdWindow::CmdVerify(int type)
 
 			if (verbose == verboseAll)
 			{
-				QMessageBox note(QMessageBox::Information, "Verify", translate(STR_MSGVERIFYOK), QMessageBox::Close);
+				QMessageBox note(QMessageBox::Information, "Verify", translate(STR_MSGVERIFYOK) + awip->GetGangReport(), QMessageBox::Close);
 				note.setStyleSheet(programStyleSheet);
 				note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
 				note.exec();
@@ -3341,6 +3444,10 @@ int e2CmdWindow::CmdProgram()
 		verbose = verboseErr;        //Disable all ok messages
 	}
 
+	//Power up and probe once for all the phases; any error ends the
+	// session (the chain stops) and the device is powered down
+	BeginSession();
+
 	if ((prog_opt & RELOAD_YES))
 	{
 		result = CmdReload();
@@ -3371,7 +3478,25 @@ int e2CmdWindow::CmdProgram()
 		result = CmdReadCalibration(0);
 	}
 
-	if (result == OK && (prog_opt & ERASE_YES))
+	//Parts fresh from the reel are already blank: no need to erase them
+	bool blank = false;
+
+	if (result == OK && (prog_opt & BLANKCHECK_YES))
+	{
+		if (prog_opt & ERASE_YES)
+		{
+			//Not blank is not an error here, the erase follows
+			doProgress(translate(STR_MSGREADING));
+			blank = (awip->BlankCheck(ALL_TYPE) == OK);
+			e2Prg->reset();
+		}
+		else
+		{
+			result = CmdBlankCheck(ALL_TYPE);
+		}
+	}
+
+	if (result == OK && (prog_opt & ERASE_YES) && !blank)
 	{
 		result = CmdErase(ALL_TYPE);
 	}
@@ -3391,6 +3516,8 @@ int e2CmdWindow::CmdProgram()
 		result = CmdWriteSecurity();
 	}
 
+	EndSession();
+
 	verbose = old_verbose;
 
 	if (result == OK)
@@ -3399,7 +3526,7 @@ int e2CmdWindow::CmdProgram()
 
 		if (verbose == verboseAll)
 		{
-			QMessageBox note(QMessageBox::Information, "Program", translate(STR_MSGPROGRAMOK), QMessageBox::Close);
+			QMessageBox note(QMessageBox::Information, "Program", translate(STR_MSGPROGRAMOK) + awip->GetConfigReport(), QMessageBox::Close);
 			note.setStyleSheet(programStyleSheet);
 			note.setButtonText(QMessageBox::Close, translate(STR_CLOSE));
 			note.exec();
@@ -3560,6 +3687,50 @@ static QStringList myscantokenizer(char *buf)//, char *arg[], int arglen)
 
 // #define cmdbuf  arg[0]
 
+//Fuse/lock da script: un numero oppure campi simbolici come nelle
+// descrizioni dei bit (es. "SET-LOCK LB=001"). Il valore e` controllato con
+// le tabelle di fusedb: se non e` valido di default si avvisa soltanto e lo
+// si usa com'e`, come prima; con ScriptStrictFuses=YES e` un errore.
+// Ritorna 0 o l'indice dell'argomento errato
+int e2CmdWindow::ScriptBitsValue(const QStringList &lst, bool lock, uint32_t &value)
+{
+	const ChipBitsDef *cb = FindChipBits(GetCurrentChipType());
+	bool ok;
+	uint32_t v = lst.at(1).toLong(&ok, 0);
+
+	if (!ok)
+	{
+		if (cb == NULL)
+		{
+			return 1;
+		}
+
+		v = lock ? awip->GetLockBits() : awip->GetFuseBits();
+
+		for (int k = 1; k < lst.count(); k++)
+		{
+			if (EncodeFuseField(lock ? cb->lock : cb->fuse, lst.at(k).toLatin1().constData(), v) != OK)
+			{
+				return k;
+			}
+		}
+	}
+
+	if (cb != NULL && ValidateFuseField(lock ? cb->lock : cb->fuse, v) != OK)
+	{
+		qWarning() << "Script:" << (lock ? "lock" : "fuse") << "value" << (hex) << v << (dec) << "sets undescribed bits or clears SPIEN";
+
+		if (E2Profile::GetScriptStrictFuses())
+		{
+			return 1;
+		}
+	}
+
+	value = v;
+
+	return 0;
+}
+
 int e2CmdWindow::ScriptError(int line_number, int arg_index, const QString &s, const QString msg)
 {
 	QString str;
@@ -4007,6 +4178,34 @@ int e2CmdWindow::CmdRunScript(bool test_mode)
 				result = CmdErase(ALL_TYPE);
 			}
 		}
+		else if (cmdbuf == "AUTOIDENTIFY")
+		{
+			if (!test_mode)
+			{
+				result = CmdAutoIdentify();
+			}
+		}
+		else if (cmdbuf == "BLANKCHECK-ALL")
+		{
+			if (!test_mode)
+			{
+				result = CmdBlankCheck(ALL_TYPE);
+			}
+		}
+		else if (cmdbuf == "BLANKCHECK-PROG")
+		{
+			if (!test_mode)
+			{
+				result = CmdBlankCheck(PROG_TYPE);
+			}
+		}
+		else if (cmdbuf == "BLANKCHECK-DATA")
+		{
+			if (!test_mode)
+			{
+				result = CmdBlankCheck(DATA_TYPE);
+			}
+		}
 		else if (cmdbuf == "VERIFY-ALL")
 		{
 			if (!test_mode)
@@ -4028,16 +4227,26 @@ int e2CmdWindow::CmdRunScript(bool test_mode)
 				result = CmdVerify(DATA_TYPE);
 			}
 		}
+		else if (cmdbuf == "REPAIR")
+		{
+			//reprogram the pages that failed the last verify
+			if (!test_mode)
+			{
+				int retries = E2Profile::GetRepairRetries();
+
+				result = (awip->Repair(retries > 0 ? retries : 3) > 0) ? OK : CMD_VERIFYFAILED;
+			}
+		}
 		else if (cmdbuf == "WRITE-FUSE")
 		{
 			if (n >= 2)
 			{
-				bool ok;
-				long fuse = lst.at(1).toLong(&ok, 0);
+				uint32_t fuse;
+				int bad_arg = ScriptBitsValue(lst, false, fuse);
 
-				if (!ok)
+				if (bad_arg)
 				{
-					result = ScriptError(linecounter, 1, lst.at(1));
+					result = ScriptError(linecounter, bad_arg, lst.at(bad_arg));
 				}
 				else if (!test_mode)
 				{
@@ -4057,12 +4266,12 @@ int e2CmdWindow::CmdRunScript(bool test_mode)
 		{
 			if (n >= 2)
 			{
-				bool ok;
-				long fuse = lst.at(1).toLong(&ok, 0);
+				uint32_t fuse;
+				int bad_arg = ScriptBitsValue(lst, false, fuse);
 
-				if (!ok)
+				if (bad_arg)
 				{
-					result = ScriptError(linecounter, 1, lst.at(1));
+					result = ScriptError(linecounter, bad_arg, lst.at(bad_arg));
 				}
 				else if (!test_mode)
 				{
@@ -4078,12 +4287,12 @@ int e2CmdWindow::CmdRunScript(bool test_mode)
 		{
 			if (n >= 2)
 			{
-				bool ok;
-				long lock = lst.at(1).toLong(&ok, 0);
+				uint32_t lock;
+				int bad_arg = ScriptBitsValue(lst, true, lock);
 
-				if (!ok)
+				if (bad_arg)
 				{
-					result = ScriptError(linecounter, 1, lst.at(1));
+					result = ScriptError(linecounter, bad_arg, lst.at(bad_arg));
 				}
 				else if (!test_mode)
 				{
@@ -4103,12 +4312,12 @@ int e2CmdWindow::CmdRunScript(bool test_mode)
 		{
 			if (n >= 2)
 			{
-				bool ok;
-				long lock = lst.at(1).toLong(&ok, 0);
+				uint32_t lock;
+				int bad_arg = ScriptBitsValue(lst, true, lock);
 
-				if (!ok)
+				if (bad_arg)
 				{
-					result = ScriptError(linecounter, 1, lst.at(1));
+					result = ScriptError(linecounter, bad_arg, lst.at(bad_arg));
 				}
 				else if (!test_mode)
 				{
@@ -6793,6 +7002,13 @@ void e2CmdWindow::SetAppBusy()
 {
 	qDebug() << "SetAppBusy()";
 	app_status = AppBusy;
+
+	//a new job starts
+	if (awip)
+	{
+		awip->ClearProbeCache();
+		awip->ClearConfigReport();
+	}
 	// EK 2017
 	// TODO
 	//SendWindowCommandAll(idEnableToolBar, 0, C_Button);
@@ -261,6 +261,8 @@ class e2CmdWindow : public QMainWindow, public e2App, public Ui::MainWindow
 	int CmdWrite(int type = ALL_TYPE, bool verify = true);
 	int CmdVerify(int type = ALL_TYPE);
 	int CmdErase(int type = ALL_TYPE);
+	int CmdBlankCheck(int type = ALL_TYPE);
+	int CmdAutoIdentify();
 	int CmdGetInfo();
 	int CmdReset();
 	int CmdReadLock();
@@ -370,6 +372,7 @@ class e2CmdWindow : public QMainWindow, public e2App, public Ui::MainWindow
 	void setMenuIndexes();
 	void selectTypeSubtype(const QString &t, const QString &st);
 	int ScriptError(int line_number, int arg_index, const QString &s, const QString msg = "");
+	int ScriptBitsValue(const QStringList &lst, bool lock, uint32_t &value);
 
 
   private:
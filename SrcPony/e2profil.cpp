@@ -365,10 +365,11 @@ void E2Profile::SetPolarityControl(uint8_t polarity_control)
 }
 
 
+//Override della dimensione pagina, 0 --> usa quella del device
 int E2Profile::GetI2CPageWrite()
 {
-	QString sp = s->value("I2CBusPageWrite", "16").toString();
-	int rval = 16;          //Default: 16 bytes page write (only for 16-bit I2C Bus eeprom)
+	QString sp = s->value("I2CPageWriteOverride", "0").toString();
+	int rval = 0;           //Default: page size from the device table
 
 	if (sp.length())
 	{
@@ -381,17 +382,18 @@ int E2Profile::GetI2CPageWrite()
 
 void E2Profile::SetI2CPageWrite(int page_write)
 {
-	if (page_write > 0)
+	if (page_write >= 0)
 	{
-		s->setValue("I2CBusPageWrite", QString::number(page_write));
+		s->setValue("I2CPageWriteOverride", QString::number(page_write));
 	}
 }
 
 
+//Override della dimensione pagina, 0 --> usa quella del device
 int E2Profile::GetSPIPageWrite()
 {
-	QString sp = s->value("BigSPIPageWrite", "16").toString();
-	int rval = 16;          //Default: 16 bytes page write
+	QString sp = s->value("SPIPageWriteOverride", "0").toString();
+	int rval = 0;           //Default: page size from the device table
 
 	if (sp.length())
 	{
@@ -404,9 +406,9 @@ int E2Profile::GetSPIPageWrite()
 
 void E2Profile::SetSPIPageWrite(int page_write)
 {
-	if (page_write > 0)
+	if (page_write >= 0)
 	{
-		s->setValue("BigSPIPageWrite", QString::number(page_write));
+		s->setValue("SPIPageWriteOverride", QString::number(page_write));
 	}
 }
 
@@ -1351,6 +1353,14 @@ long E2Profile::GetProgramOptions()
 			res |= LOCK_YES;
 		}
 
+	rval = s->value("BlankCheckOption", "").toString();
+
+	if (rval.length())
+		if (rval != "NO")
+		{
+			res |= BLANKCHECK_YES;
+		}
+
 	return res;
 }
 
@@ -1377,6 +1387,8 @@ void E2Profile::SetProgramOptions(long prog_option)
 				(prog_option & EEPROM_YES) ? "YES" : "NO");
 	s->setValue("WriteSecurityOption",
 				(prog_option & LOCK_YES) ? "YES" : "NO");
+	s->setValue("BlankCheckOption",
+				(prog_option & BLANKCHECK_YES) ? "YES" : "NO");
 }
 
 
@@ -1863,6 +1875,113 @@ void E2Profile::Set8253FallEdge(bool enabled)
 }
 
 
+bool E2Profile::GetI2CGangMode()
+{
+	QString sp = s->value("I2CGangMode", "").toString();
+
+	if (sp.length() && (sp == "YES"))
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+
+void E2Profile::SetI2CGangMode(bool enabled)
+{
+	if (enabled)
+	{
+		s->setValue("I2CGangMode", "YES");
+	}
+	else
+	{
+		s->setValue("I2CGangMode", "NO");
+	}
+}
+
+
+bool E2Profile::GetDiffWrite()
+{
+	QString sp = s->value("DifferentialWrite", "").toString();
+
+	if (sp.length() && (sp == "YES"))
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+
+void E2Profile::SetDiffWrite(bool enabled)
+{
+	if (enabled)
+	{
+		s->setValue("DifferentialWrite", "YES");
+	}
+	else
+	{
+		s->setValue("DifferentialWrite", "NO");
+	}
+}
+
+
+bool E2Profile::GetInlineVerify()
+{
+	QString sp = s->value("InlineVerify", "").toString();
+
+	if (sp.length() && (sp == "YES"))
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+
+void E2Profile::SetInlineVerify(bool enabled)
+{
+	if (enabled)
+	{
+		s->setValue("InlineVerify", "YES");
+	}
+	else
+	{
+		s->setValue("InlineVerify", "NO");
+	}
+}
+
+
+int E2Profile::GetRepairRetries()
+{
+	QString sp = s->value("VerifyRepairRetries", "0").toString();
+	int rval = 0;           //Default: no repair after a failed verify
+
+	if (sp.length())
+	{
+		rval = sp.toInt();
+	}
+
+	return rval;
+}
+
+
+void E2Profile::SetRepairRetries(int retries)
+{
+	if (retries >= 0)
+	{
+		s->setValue("VerifyRepairRetries", QString::number(retries));
+	}
+}
+
+
 bool E2Profile::GetSoundEnabled()
 {
 	QString sp = s->value("SoundEnabled", "").toString();
@@ -1994,6 +2113,36 @@ void E2Profile::SetVerifyAfterWrite(bool enabled)
 }
 
 
+//Fuse/lock da script che non passano ValidateFuseField(): con NO (default)
+// solo un avviso, con YES lo script si ferma con errore
+bool E2Profile::GetScriptStrictFuses()
+{
+	QString sp = s->value("ScriptStrictFuses", "NO").toString();
+
+	if (sp.length() && (sp == "YES"))
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+
+void E2Profile::SetScriptStrictFuses(bool enabled)
+{
+	if (enabled)
+	{
+		s->setValue("ScriptStrictFuses", "YES");
+	}
+	else
+	{
+		s->setValue("ScriptStrictFuses", "NO");
+	}
+}
+
+
 bool E2Profile::GetAutoDetectPorts()
 {
 	QString sp = s->value("AutoDetectPorts", "YES").toString();
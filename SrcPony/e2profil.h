@@ -49,6 +49,7 @@
 #define FLASH_idx               7
 #define EEPROM_idx              8
 #define LOCK_idx                9
+#define BLANKCHECK_idx          10
 
 #define RELOAD_YES              (1<<RELOAD_idx)
 #define READFLASH_YES           (1<<READFLASH_idx)
@@ -60,6 +61,7 @@
 #define EEPROM_YES              (1<<EEPROM_idx)
 #define LOCK_YES                (1<<LOCK_idx)
 #define READOSCAL_YES          (1<<READOSCCAL_idx)
+#define BLANKCHECK_YES          (1<<BLANKCHECK_idx)
 
 
 typedef enum
@@ -110,10 +112,10 @@ class E2Profile
 	static void SetPolarityControl(uint8_t polarity_control);
 
 	static int GetSPIPageWrite();
-	static void SetSPIPageWrite(int page_write = 1);
+	static void SetSPIPageWrite(int page_write = 0);
 
 	static int GetI2CPageWrite();
-	static void SetI2CPageWrite(int page_write = 1);
+	static void SetI2CPageWrite(int page_write = 0);
 
 	static int GetI2CBaseAddr();
 	static void SetI2CBaseAddr(int base_addr = 0xA0);
@@ -217,6 +219,18 @@ class E2Profile
 	static bool Get8253FallEdge();
 	static void Set8253FallEdge(bool falledge);
 
+	static bool GetI2CGangMode();
+	static void SetI2CGangMode(bool enabled = false);
+
+	static bool GetDiffWrite();
+	static void SetDiffWrite(bool enabled = false);
+
+	static bool GetInlineVerify();
+	static void SetInlineVerify(bool enabled = false);
+
+	static int GetRepairRetries();
+	static void SetRepairRetries(int retries = 0);
+
 	static QString GetLanguageCode();
 	static void SetLanguageCode(const QString &code);
 
@@ -226,6 +240,9 @@ class E2Profile
 	static bool GetVerifyAfterWrite();
 	static void SetVerifyAfterWrite(bool enabled = true);
 
+	static bool GetScriptStrictFuses();
+	static void SetScriptStrictFuses(bool enabled = false);
+
 	static int GetJDMCmd2CmdDelay();
 	static void SetJDMCmd2CmdDelay(int delay = 4000);
 
@@ -40,11 +40,29 @@
 
 static QVector<chipInfo> const eep24xx_map =
 {
-	{ "24XX Auto", E2400, AUTOSIZE_ID / 256, -1, -1, -1 },
-	{"2402", E2402, 1, -1, -1, -1},
-	{"2404", E2404, 2, -1, -1, -1},
-	{"2408", E2408, 4, -1, -1, -1},
-	{"2416", E2416, 8, -1, -1, -1}
+	{ "24XX Auto", E2400, AUTOSIZE_ID / 256, -1, -1, -1, 1, 256 },
+	{"2402", E2402, 1, -1, 8, -1, 1, 256},
+	{"2404", E2404, 2, -1, 16, -1, 1, 256},
+	{"2408", E2408, 4, -1, 16, -1, 1, 256},
+	{"2416", E2416, 8, -1, 16, -1, 1, 256}
+};
+
+
+//I2C timing profile of the 24xx parts rated above Standard mode,
+// all the other devices use I2C_STANDARD
+static const struct
+{
+	long id;
+	int  mode;
+} eep24xx_i2cmode[] =
+{
+	{E2432, I2C_FASTMODE},
+	{E2464, I2C_FASTMODE},
+	{E24128, I2C_FASTMODE},
+	{E24256, I2C_FASTMODE},
+	{E24512, I2C_FASTMODE},
+	{E24325, I2C_FASTMODE},
+	{E24645, I2C_FASTMODE}
 };
 
 
@@ -66,20 +84,20 @@ static QVector<chipInfo> const eep24xx1B_map =
 static QVector<chipInfo> const eep24xx2_map =
 {
 	//      "Auto",
-	{"24E16", E24E16, 8, -1, -1, -1},
-	{"2432", E2432, 16, -1, -1, -1},
-	{"2464/2465", E2464, 32, -1, -1, -1},
-	{"24128", E24128, 64, -1, -1, -1},
-	{"24256", E24256, 128, -1, -1, -1},
-	{"24512", E24512, 256, -1, -1, -1}
+	{"24E16", E24E16, 8, -1, 16, -1, 2, KB(2)},
+	{"2432", E2432, 16, -1, 32, -1, 2, KB(4)},
+	{"2464/2465", E2464, 32, -1, 32, -1, 2, KB(8)},
+	{"24128", E24128, 64, -1, 64, -1, 2, KB(16)},
+	{"24256", E24256, 128, -1, 64, -1, 2, KB(32)},
+	{"24512", E24512, 256, -1, 128, -1, 2, KB(64)}
 };
 
 
 static QVector<chipInfo> const eep24xx5_map =
 {
 	//      "Auto",
-	{"24325", E24325, 16, -1, -1, -1},
-	{"24645", E24645, 32, -1, -1, -1}
+	{"24325", E24325, 16, -1, 32, -1, 1, 256},
+	{"24645", E24645, 32, -1, 32, -1, 1, 256}
 };
 
 
@@ -103,45 +121,45 @@ static QVector<chipInfo> const eepAt90s_map =
 
 	{"ATmega8515", ATmega8515, (KB(8) + 512), KB(8), 64, -1 },
 	{"ATmega8535", ATmega8535, (KB(8) + 512), KB(8), 64, -1 },
-	{"ATmega48", ATmega48, (KB(4) + 256), KB(4), 64, -1},
+	{"ATmega48", ATmega48, (KB(4) + 256), KB(4), 64, -1, 0, 0, 4},
 	{"ATmega8", ATmega8, (KB(8) + 512), KB(8), 64, -1},
-	{"ATmega88", ATmega88, (KB(8) + 512), KB(8),  64, -1},
+	{"ATmega88", ATmega88, (KB(8) + 512), KB(8),  64, -1, 0, 0, 4},
 	{"ATmega16", ATmega16, (KB(16) + 512), KB(16), 128, -1},
 	{"ATmega161", ATmega161, (KB(16) + 512), KB(16), 128, -1},
 	{"ATmega162", ATmega162, (KB(16) + 512), KB(16), 128, -1},
 	{"ATmega163", ATmega163, (KB(16) + 512), KB(16), 128, -1},
-	{"ATmega164", ATmega164, (KB(16) + 512), KB(16), 128, -1},
-	{"ATmega168", ATmega168, (KB(16) + 512), KB(16), 128, -1},
+	{"ATmega164", ATmega164, (KB(16) + 512), KB(16), 128, -1, 0, 0, 4},
+	{"ATmega168", ATmega168, (KB(16) + 512), KB(16), 128, -1, 0, 0, 4},
 	{"ATmega169", ATmega169, (KB(16) + 512), KB(16), 128, -1},
 	{"ATmega32", ATmega32, (KB(32) + KB(1)), KB(32), 128, -1},
 
 	{"ATmega323", ATmega323, (KB(32) + KB(1)), KB(32), 128, -1},
-	{"ATmega324", ATmega324, (KB(32) + KB(1)), KB(32), 128, -1},
-	{"ATmega328", ATmega328, (KB(32) + KB(1)), KB(32), 128, -1}, // new (RG 22.06.2012)
+	{"ATmega324", ATmega324, (KB(32) + KB(1)), KB(32), 128, -1, 0, 0, 4},
+	{"ATmega328", ATmega328, (KB(32) + KB(1)), KB(32), 128, -1, 0, 0, 4}, // new (RG 22.06.2012)
 	{"ATmega603", ATmega603, (KB(64) + KB(2)), KB(64), 256, -1},
 	{"ATmega103", ATmega103, (KB(128) + KB(4)), KB(128), 256, -1},
 	{"ATmega64", ATmega64, (KB(64) + KB(2)), KB(64), 256, -1},
-	{"ATmega640", ATmega640, (KB(64) + KB(4)), KB(64), 256, -1},
-	{"ATmega644", ATmega644, (KB(64) + KB(2)), KB(64), 256, -1},
+	{"ATmega640", ATmega640, (KB(64) + KB(4)), KB(64), 256, -1, 0, 0, 8},
+	{"ATmega644", ATmega644, (KB(64) + KB(2)), KB(64), 256, -1, 0, 0, 8},
 	{"ATmega128", ATmega128, (KB(128) + KB(4)), KB(128), 256, -1},
-	{"ATmega1280", ATmega1280, (KB(128) + KB(4)), KB(128), 256, -1},
-	{"ATmega1281", ATmega1281, (KB(128) + KB(4)), KB(128), 256, -1},
-	{"ATmega2560", ATmega2560, (KB(256) + KB(4)), KB(256), 256, -1},
-	{"ATmega2561", ATmega2561, (KB(256) + KB(4)), KB(256), 256, -1},
+	{"ATmega1280", ATmega1280, (KB(128) + KB(4)), KB(128), 256, -1, 0, 0, 8},
+	{"ATmega1281", ATmega1281, (KB(128) + KB(4)), KB(128), 256, -1, 0, 0, 8},
+	{"ATmega2560", ATmega2560, (KB(256) + KB(4)), KB(256), 256, -1, 0, 0, 8},
+	{"ATmega2561", ATmega2561, (KB(256) + KB(4)), KB(256), 256, -1, 0, 0, 8},
 
 	{"ATtiny12", ATtiny12, (KB(1) + 64), KB(1), 0, -1},
-	{"ATtiny13", ATtiny13, (KB(1) + 64), KB(1), 32, -1},
+	{"ATtiny13", ATtiny13, (KB(1) + 64), KB(1), 32, -1, 0, 0, 4},
 	{"ATtiny15", ATtiny15, (KB(1) + 64), KB(1), 0, -1},
 	{"ATtiny22", ATtiny22, (KB(2) + 128), KB(2), 0, -1},
-	{"ATtiny25", ATtiny25, (KB(2) + 128), KB(2), 32, -1},
+	{"ATtiny25", ATtiny25, (KB(2) + 128), KB(2), 32, -1, 0, 0, 4},
 	{"ATtiny26", ATtiny26, (KB(2) + 128), KB(2), 32, -1},
-	{"ATtiny261", ATtiny261, (KB(2) + 128), KB(2), 32, -1},
+	{"ATtiny261", ATtiny261, (KB(2) + 128), KB(2), 32, -1, 0, 0, 4},
 	//      {"ATtiny28", ATtiny28, },
-	{"ATtiny2313", ATtiny2313, (KB(2) + 128), KB(2), 32, -1},
-	{"ATtiny45", ATtiny45, (KB(4) + 256), KB(4), 64,  -1},
-	{"ATtiny461", ATtiny461, (KB(4) + 256), KB(4), 64, -1},
-	{"ATtiny85", ATtiny85, (KB(8) + 512), KB(8), 64, -1},
-	{"ATtiny861", ATtiny861, (KB(8) + 512), KB(8), 64, -1}
+	{"ATtiny2313", ATtiny2313, (KB(2) + 128), KB(2), 32, -1, 0, 0, 4},
+	{"ATtiny45", ATtiny45, (KB(4) + 256), KB(4), 64,  -1, 0, 0, 4},
+	{"ATtiny461", ATtiny461, (KB(4) + 256), KB(4), 64, -1, 0, 0, 4},
+	{"ATtiny85", ATtiny85, (KB(8) + 512), KB(8), 64, -1, 0, 0, 4},
+	{"ATtiny861", ATtiny861, (KB(8) + 512), KB(8), 64, -1, 0, 0, 4}
 };
 
 
@@ -159,7 +177,7 @@ static QVector<chipInfo> const eepAt89s_map =
 static QVector<chipInfo> const eep93x6_map =
 {
 	//      "93XX Auto", E9300
-	{"9306", E9306, 16, -1, -1, 64},
+	{"9306", E9306, 16, -1, -1, 64, 0, -1},
 	{"9346", E9346, 64, -1, -1, 64},
 	{"9356", E9356, 128, -1, -1, 256},
 	{"9357", E9357, 128, -1, -1, 128},
@@ -172,7 +190,7 @@ static QVector<chipInfo> const eep93x6_map =
 static QVector<chipInfo> const eep93xx8_map =
 {
 	//      "93XX Auto",
-	{"9306", E9306_8, 32, -1, -1, 128},
+	{"9306", E9306_8, 32, -1, -1, 128, 0, -1},
 	{"9346", E9346_8, 128, -1, -1, 128},
 	{"9356", E9356_8, 256, -1, -1, 512},
 	{"9357", E9357_8, 256, -1, -1, 256},
@@ -203,10 +221,10 @@ static QVector<chipInfo> const eepPic168xx_map =
 	{"PIC16F876", PIC16876, KB(16) + 256, KB(16), -1, -1},
 	{"PIC16F877", PIC16877, KB(16) + 256, KB(16), -1, -1},
 
-	{"PIC16F873A", PIC16873A, KB(8) + 128, KB(8), -1, -1},
-	{"PIC16F874A", PIC16874A, KB(8) + 128, KB(8), -1, -1},
-	{"PIC16F876A", PIC16876A, KB(16) + 256, KB(16), -1, -1},
-	{"PIC16F877A", PIC16877A, KB(16) + 256, KB(16), -1, -1},
+	{"PIC16F873A", PIC16873A, KB(8) + 128, KB(8), 16, -1},
+	{"PIC16F874A", PIC16874A, KB(8) + 128, KB(8), 16, -1},
+	{"PIC16F876A", PIC16876A, KB(16) + 256, KB(16), 16, -1},
+	{"PIC16F877A", PIC16877A, KB(16) + 256, KB(16), 16, -1},
 
 	{"PIC16F627", PIC16627, KB(1) + 128, KB(1), -1, -1},
 	{"PIC16F628", PIC16628, KB(2) + 128, KB(2), -1, -1}
@@ -232,21 +250,35 @@ static QVector<chipInfo> const eepPic125_map =
 static QVector<chipInfo> const eep250xx_map =
 {
 	//      "250X0 Auto",
-	{"25010", E25010, 128, -1, -1, -1},
-	{"25020", E25020, 256, -1, -1, -1},
-	{"25040", E25040, 512, -1, -1, -1}
+	{"25010", E25010, 128, -1, 8, -1, 1, 128},
+	{"25020", E25020, 256, -1, 8, -1, 1, 256},
+	{"25040", E25040, 512, -1, 8, -1, 1, 512}
 };
 
 
 static QVector<chipInfo> const eep25xxx_map =
 {
 	//      "25XXX Auto",E25XX0
-	{"25080", E25080, KB(1), -1, -1, -1},
-	{"25160", E25160, KB(2), -1, -1, -1},
-	{"25320", E25320, KB(4), -1, -1, -1},
-	{"2564X/95640", E25640, KB(8), -1, -1, -1},
-	{"25128", E25128, KB(16), -1, -1, -1},
-	{"25256", E25256, KB(32), -1, -1, -1}
+	{"25080", E25080, KB(1), -1, 16, -1, 2, KB(1)},
+	{"25160", E25160, KB(2), -1, 16, -1, 2, KB(2)},
+	{"25320", E25320, KB(4), -1, 32, -1, 2, KB(4)},
+	{"2564X/95640", E25640, KB(8), -1, 32, -1, 2, KB(8)},
+	{"25128", E25128, KB(16), -1, 64, -1, 2, KB(16)},
+	{"25256", E25256, KB(32), -1, 64, -1, 2, KB(32)}
+};
+
+
+//SPI NOR flash: 256 bytes page program, 4 address bytes over 16MB
+static QVector<chipInfo> const eep25qxx_map =
+{
+	{"25QXX Auto", E25Q00, AUTOSIZE_ID, -1, 256, -1, 3, 0},
+	{"25Q40", E25Q40, KB(512), -1, 256, -1, 3, 0},
+	{"25Q80", E25Q80, MB(1), -1, 256, -1, 3, 0},
+	{"25Q16", E25Q16, MB(2), -1, 256, -1, 3, 0},
+	{"25Q32", E25Q32, MB(4), -1, 256, -1, 3, 0},
+	{"25Q64", E25Q64, MB(8), -1, 256, -1, 3, 0},
+	{"25Q128", E25Q128, MB(16), -1, 256, -1, 3, 0},
+	{"25Q256", E25Q256, MB(32), -1, 256, -1, 4, 0}
 };
 
 
@@ -400,6 +432,10 @@ static QVector<chipInfo> const GetMap(int pritype)
 		return eep25xxx_map;
 		break;
 
+	case E25QXX:
+		return eep25qxx_map;
+		break;
+
 	case E2506XX:
 		return eep2506_map;
 		break;
@@ -610,6 +646,73 @@ int GetEEPTypeWPageSize(unsigned long type)
 	return i.wpgsz;
 }
 
+int GetEEPTypeI2CMode(unsigned long type)
+{
+	int pritype = GetE2PPriType(type);
+	int subtype = GetE2PSubType(type);
+
+	for (unsigned int k = 0; k < sizeof(eep24xx_i2cmode) / sizeof(eep24xx_i2cmode[0]); k++)
+	{
+		if (GetE2PPriType(eep24xx_i2cmode[k].id) == pritype && GetE2PSubType(eep24xx_i2cmode[k].id) == subtype)
+		{
+			return eep24xx_i2cmode[k].mode;
+		}
+	}
+
+	return I2C_STANDARD;
+}
+
+int GetEEPTypeAddrBytes(unsigned long type)
+{
+	int pritype = GetE2PPriType(type);
+	int subtype = GetE2PSubType(type);
+
+	QVector<chipInfo> mp = GetMap(pritype);
+
+	if (mp.count() == 0)
+	{
+		return 0;
+	}
+
+	chipInfo i = GetChipInfo(mp, subtype);
+
+	return i.adrbytes;
+}
+
+int GetEEPTypeSeqReadSize(unsigned long type)
+{
+	int pritype = GetE2PPriType(type);
+	int subtype = GetE2PSubType(type);
+
+	QVector<chipInfo> mp = GetMap(pritype);
+
+	if (mp.count() == 0)
+	{
+		return 0;
+	}
+
+	chipInfo i = GetChipInfo(mp, subtype);
+
+	return i.rdsz;
+}
+
+
+int GetEEPTypeEEPPageSize(unsigned long type)
+{
+	int pritype = GetE2PPriType(type);
+	int subtype = GetE2PSubType(type);
+
+	QVector<chipInfo> mp = GetMap(pritype);
+
+	if (mp.count() == 0)
+	{
+		return 0;
+	}
+
+	chipInfo i = GetChipInfo(mp, subtype);
+
+	return i.epgsz;
+}
 
 QVector<chipInfo> GetEEPSubTypeVector(int type)
 {
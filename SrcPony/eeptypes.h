@@ -258,12 +258,24 @@
 // Sub types
 #define E2401_B         0x130001
 
-#define NO_OF_EEPTYPE   0x13
+#define E25QXX          0x14
+// Sub types (JEDEC capacity code, size = 1 << code)
+#define E25Q00          0x140000
+#define E25Q40          0x140013
+#define E25Q80          0x140014
+#define E25Q16          0x140015
+#define E25Q32          0x140016
+#define E25Q64          0x140017
+#define E25Q128         0x140018
+#define E25Q256         0x140019
+
+#define NO_OF_EEPTYPE   0x14
 
 #define MAXEEPSUBTYPE   64
 
 
 #define KB(x)   ((x) * 1024)
+#define MB(x)   ((x) * 1024 * 1024)
 
 
 // EK 2017
@@ -276,6 +288,9 @@ struct chipInfo
 	int  splt;  // split
 	int  wpgsz; // page size
 	int  adrsz; //dimensione dello spazio di indirizzamento in numero di banchi
+	int  adrbytes; //address bytes sent after the command/device byte (0 if not specified)
+	int  rdsz;  //max sequential read length in bytes (0 if not specified, -1 no sequential read)
+	int  epgsz; //EEPROM page size for page mode programming (0 --> byte write)
 };
 
 
@@ -306,6 +321,10 @@ extern long GetEEPTypeFromString(const QString &name);
 
 // extern int GetEEPTypeWPageSize(int pritype, int subtype);
 extern int GetEEPTypeWPageSize(unsigned long type);
+extern int GetEEPTypeI2CMode(unsigned long type);
+extern int GetEEPTypeAddrBytes(unsigned long type);
+extern int GetEEPTypeSeqReadSize(unsigned long type);
+extern int GetEEPTypeEEPPageSize(unsigned long type);
 
 
 #endif
@@ -60,6 +60,7 @@
 #define DEVICE_UNKNOWN          -24
 #define DEVICE_LOCKED           -25
 #define OP_ABORTED              -26
+#define E2ERR_VERIFYFAILED      -27
 
 #define BUFFEROVERFLOW          -30
 #define OUTOFMEMORY             -31
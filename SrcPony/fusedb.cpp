@@ -0,0 +1,4696 @@
+//=========================================================================//
+//                                                                         //
+//  PonyProg - Serial Device Programmer                                    //
+//                                                                         //
+//  Copyright (C) 1997-2017   Claudio Lanconelli                           //
+//                                                                         //
+//  http://ponyprog.sourceforge.net                                        //
+//                                                                         //
+//-------------------------------------------------------------------------//
+//                                                                         //
+// This program is free software; you can redistribute it and/or           //
+// modify it under the terms of the GNU  General Public License            //
+// as published by the Free Software Foundation; either version2 of        //
+// the License, or (at your option) any later version.                     //
+//                                                                         //
+// This program is distributed in the hope that it will be useful,         //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of          //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU       //
+// General Public License for more details.                                //
+//                                                                         //
+// You should have received a copy of the GNU  General Public License      //
+// along with this program (see LICENSE);     if not, write to the         //
+// Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. //
+//                                                                         //
+//=========================================================================//
+
+#include <string.h>
+#include <ctype.h>
+
+#include "fusedb.h"
+#include "eeptypes.h"
+#include "errcode.h"
+
+//Tabelle costanti: nessuna costruzione allo startup, ricerca binaria per ID.
+//Per aggiungere un chip: le sue tabelle, una riga in chip_bits[] e gli ID
+// in chip_index[] (ordinato per valore, controllato in compilazione).
+
+#define BITS(t)         t, (int)(sizeof(t) / sizeof(t[0]))
+#define NOBITS          NULL, 0
+
+//AT89S8252, AT89S53 ???
+static constexpr FuseBitDef at89s8252_lock[] =
+{
+	{ 5, "LB5", "" },
+	{ 6, "LB6", "" },
+	{ 7, "LB7", "" }
+};
+
+static constexpr FuseMaskDef at89s8252_lockdescr[] =
+{
+	{ "LB=000", "Mode 1: No memory lock features enabled" },
+	{ "LB=001", "Mode 2: MOVC disabled" },
+	{ "LB=011", "Mode 3: Verify disabled" },
+	{ "LB=111", "Mode 4: External execution disabled" }
+};
+
+//AT89S8253 ???
+static constexpr FuseBitDef at89s8253_fuse[] =
+{
+	{ 0, "ClkSel", "" },
+	{ 1, "UserRow", "" },
+	{ 2, "x2Mode", ""},
+	{ 3, "SerProg", "" }
+};
+
+static constexpr FuseBitDef at89s8253_lock[] =
+{
+	{ 0, "LB0", "" },
+	{ 1, "LB1", "" },
+	{ 2, "LB2", "" }
+};
+
+static constexpr FuseMaskDef at89s8253_lockdescr[] =
+{
+	{ "LB=000", "Mode 1: No memory lock features enabled" },
+	{ "LB=001", "Mode 2: MOVC disabled" },
+	{ "LB=011", "Mode 3: Verify disabled" },
+	{ "LB=111", "Mode 4: External execution disabled" }
+};
+
+//AT89S51, AT89S52 ???
+static constexpr FuseBitDef at89s51_lock[] =
+{
+	{ 2, "LB2", "" },
+	{ 3, "LB3", "" },
+	{ 4, "LB4", "" }
+};
+
+static constexpr FuseMaskDef at89s51_lockdescr[] =
+{
+	{ "LB=000", "Mode 1: No memory lock features enabled" },
+	{ "LB=001", "Mode 2: MOVC disabled" },
+	{ "LB=011", "Mode 3: Verify disabled" },
+	{ "LB=111", "Mode 4: External execution disabled" }
+};
+
+#if 0
+//AT89S52 ???
+static constexpr FuseBitDef at89s52_lock[] =
+{
+	{ 2, "LB2", "" },
+	{ 3, "LB3", "" },
+	{ 4, "LB4", "" }
+};
+
+static constexpr FuseMaskDef at89s52_lockdescr[] =
+{
+	{ "LB=000", "Mode 1: No memory lock features enabled" },
+	{ "LB=001", "Mode 2: MOVC disabled" },
+	{ "LB=011", "Mode 3: Verify disabled" },
+	{ "LB=111", "Mode 4: External execution disabled" }
+};
+#endif
+
+#if 0
+//AT89S53 ???
+static constexpr FuseBitDef at89s53_lock[] =
+{
+	{ 5, "LB5", "" },
+	{ 6, "LB6", "" },
+	{ 7, "LB7", "" }
+};
+
+static constexpr FuseMaskDef at89s53_lockdescr[] =
+{
+	{ "LB=000", "Mode 1: No memory lock features enabled" },
+	{ "LB=001", "Mode 2: MOVC disabled" },
+	{ "LB=011", "Mode 3: Verify disabled" },
+	{ "LB=111", "Mode 4: External execution disabled" }
+};
+#endif
+
+//AT90CAN32
+static constexpr FuseBitDef at90can32_fuse[] =
+{
+	// byte low
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTC7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	// byte high
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watchdog timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	// byte ext
+	{ 16, "TA0SEL", "Reserved for factory tests" },
+	{ 17, "BODLEVEL0", "" },
+	{ 18, "BODLEVEL1", "" },
+	{ 19, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef at90can32_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=10", "Boot Flash section size=1024 words Boot start address=$3C00" },
+	{ "BOOTSZ=01", "Boot Flash section size=2048 words Boot start address=$3800" },
+	{ "BOOTSZ=00", "Boot Flash section size=4096 words Boot start address=$3000" },
+	{ "BOOTSZ=11", "Boot Flash section size=512 words Boot start address=$3E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=000", "Brown-out detection level at VCC=2.5 V" },
+	{ "BODLEVEL=001", "Brown-out detection level at VCC=2.6 V" },
+	{ "BODLEVEL=010", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=011", "Brown-out detection level at VCC=3.8 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=3.9 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=4.0 V" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=4.1 V" }
+};
+
+static constexpr FuseBitDef at90can32_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef at90can32_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//AT90CAN64
+static constexpr FuseBitDef at90can64_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTC7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watchdog timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "TA0SEL", "Reserved for factory tests" },
+	{ 17, "BODLEVEL0", "" },
+	{ 18, "BODLEVEL1", "" },
+	{ 19, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef at90can64_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=10", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=01", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=00", "Boot Flash section size=4096 words Boot start address=$7000" },
+	{ "BOOTSZ=11", "Boot Flash section size=512 words Boot start address=$7E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=000", "Brown-out detection level at VCC=2.5 V" },
+	{ "BODLEVEL=001", "Brown-out detection level at VCC=2.6 V" },
+	{ "BODLEVEL=010", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=011", "Brown-out detection level at VCC=3.8 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=3.9 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=4.0 V" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=4.1 V" }
+};
+
+static constexpr FuseBitDef at90can64_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef at90can64_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//AT90CAN128
+static constexpr FuseBitDef at90can128_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTE7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watchdog timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "TA0SEL", "Reserved for factory tests" },
+	{ 17, "BODLEVEL0", "" },
+	{ 18, "BODLEVEL1", "" },
+	{ 19, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef at90can128_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0-16.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=10", "Boot Flash section size=1024 words Boot start address=$FC00" },
+	{ "BOOTSZ=01", "Boot Flash section size=2048 words Boot start address=$F800" },
+	{ "BOOTSZ=00", "Boot Flash section size=4096 words Boot start address=$F000" },
+	{ "BOOTSZ=11", "Boot Flash section size=512 words Boot start address=$FE00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=000", "Brown-out detection level at VCC=2.5 V" },
+	{ "BODLEVEL=001", "Brown-out detection level at VCC=2.6 V" },
+	{ "BODLEVEL=010", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=011", "Brown-out detection level at VCC=3.8 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=3.9 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=4.0 V" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=4.1 V" }
+};
+
+static constexpr FuseBitDef at90can128_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef at90can128_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//AT90S1200
+static constexpr FuseBitDef at90s1200_fuse[] =
+{
+	{ 0, "/FB0", "NOT External clock enabled" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s1200_lock[] =
+{
+	{ 1, "LB1", "" },
+	{ 2, "LB2", "" }
+};
+
+static constexpr FuseMaskDef at90s1200_lockdescr[] =
+{
+	{ "LB=11", "Mode 1: No memory lock features enabled" },
+	{ "LB=10", "Mode 2: Further programming disabled" },
+	{ "LB=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//AT90S2313, AT90S4414, AT90S8515, AT90S4434, AT90S8535
+static constexpr FuseBitDef at90s2313_fuse[] =
+{
+	{ 0, "FSTRT", "Short start-up time enabled" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s2313_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s2313_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+#if 0
+//AT90S4414
+static constexpr FuseBitDef at90s4414_fuse[] =
+{
+	{ 0, "FSTRT", "Short start-up time enabled" },
+//	{ 1, "SPIEN", "" },
+//	{ 2, "FSTRT", "" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s4414_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s4414_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+#endif
+
+#if 0
+//AT90S8515
+static constexpr FuseBitDef at90s8515_fuse[] =
+{
+	{ 0, "FSTRT", "Short start-up time enabled" },
+//	{ 1, "SPIEN", "" },
+//	{ 2, "FSTRT", "" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s8515_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s8515_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+#endif
+
+#if 0
+//AT90S4434
+static constexpr FuseBitDef at90s4434_fuse[] =
+{
+	{ 0, "FSTRT", "Short start-up time enabled" },
+//	{ 1, "SPIEN", "" },
+//	{ 2, "FSTRT", "" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s4434_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s4434_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+#endif
+
+#if 0
+//AT90S8535
+static constexpr FuseBitDef at90s8535_fuse[] =
+{
+	{ 0, "FSTRT", "Short start-up time enabled" },
+//	{ 1, "SPIEN", "" },
+//	{ 2, "FSTRT", "" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s8535_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s8535_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+#endif
+
+//AT90S2333 ???
+static constexpr FuseBitDef at90s2333_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "BODEN", "Brown-out detection enabled" },
+	{ 4, "BODLEVEL", "Brown-out detection level at VCC=2.7V" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s2333_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s2333_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//AT90S4433
+static constexpr FuseBitDef at90s4433_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "BODEN", "Brown-out detection enabled" },
+	{ 4, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7V" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseMaskDef at90s4433_fusedescr[] =
+{
+	{ "CKSEL=101", "Ceramic Resonator" },
+	{ "CKSEL=111", "Ceramic Resonator; BOD Enabled or power-on reset" },
+	{ "CKSEL=110", "Ceramic Resonator; fast rising power" },
+	{ "CKSEL=100", "Crystal Oscillator; BOD Enabled or power-on reset" },
+	{ "CKSEL=010", "Crystal Oscillator; default value" },
+	{ "CKSEL=011", "Crystal Oscillator; fast rising power" },
+	{ "CKSEL=001", "External Clock; BOD Enabled or power-on reset" },
+	{ "CKSEL=000", "External Clock; slowly rising power" }
+};
+
+static constexpr FuseBitDef at90s4433_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s4433_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//AT90S2323, AT90S8534
+static constexpr FuseBitDef at90s2323_fuse[] =
+{
+	{ 0, "FSTRT", "Short start-up time enabled" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s2323_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s2323_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//AT90S2343
+static constexpr FuseBitDef at90s2343_fuse[] =
+{
+	{ 0, "/FB0", "NOT External clock enabled" }, // enabled but invert
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s2343_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s2343_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+#if 0
+//AT90S8534
+static constexpr FuseBitDef at90s8534_fuse[] =
+{
+	{ 0, "FSTRT", "Short start-up time enabled" },
+//	{ 1, "SPIEN", "" },
+//	{ 2, "FSTRT", "" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef at90s8534_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef at90s8534_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+#endif
+
+//ATtiny12
+static constexpr FuseBitDef attiny12_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "RSTDISBL", "External reset function of PB5 disabled" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=1.8 V" }
+};
+
+static constexpr FuseMaskDef attiny12_fusedescr[] =
+{
+	// fuse mask description ???
+	{ "CKSEL=0000", "External Clock" },
+	{ "CKSEL=0001", "External Clock" },
+	{ "CKSEL=0010", "Internal RC Ocsillator" },
+	{ "CKSEL=0011", "Internal RC Ocsillator" },
+	{ "CKSEL=0100", "Internal RC Ocsillator" },
+	{ "CKSEL=0101", "External RC Ocsillator" },
+	{ "CKSEL=0110", "External RC Ocsillator" },
+	{ "CKSEL=0111", "External RC Ocsillator" },
+	{ "CKSEL=1000", "External Low-Frequency Crystal" },
+	{ "CKSEL=1001", "External Low-Frequency Crystal" },
+	{ "CKSEL=1010", "External Crystal / Ceramic Resonator" },
+	{ "CKSEL=1011", "External Crystal / Ceramic Resonator" },
+	{ "CKSEL=1100", "External Crystal / Ceramic Resonator" },
+	{ "CKSEL=1101", "External Crystal / Ceramic Resonator" },
+	{ "CKSEL=1110", "External Crystal / Ceramic Resonator" },
+	{ "CKSEL=1111", "External Crystal / Ceramic Resonator" }
+};
+
+static constexpr FuseBitDef attiny12_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny12_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny13
+static constexpr FuseBitDef attiny13_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "SUT0", "" },
+	{ 3, "SUT1", "" },
+	{ 4, "CKDIV8", "Divide clock by 8 internally" },
+	{ 5, "WDTON", "Watch-dog Timer always on" },
+	{ 6, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 7, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 8, "RSTDISBL", "Reset Disabled (Enable PB5 as i/o pin)" },
+	{ 9, "BODLEVEL0", "" },
+	{ 10, "BODLEVEL1", "" },
+	{ 11, "DWEN", "Debug Wire enable" },
+	{ 12, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef attiny13_fusedescr[] =
+{
+	{ "CKSEL=00 SUT=00", "Ext. Clock; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=00 SUT=01", "Ext. Clock; Start-up time: 14 CK + 4 ms" },
+	{ "CKSEL=00 SUT=10", "Ext. Clock; Start-up time: 14 CK + 64 ms" },
+	{ "CKSEL=11 SUT=00", "Int. RC Osc. 128 kHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=11 SUT=01", "Int. RC Osc. 128 kHz; Start-up time: 14 CK + 4 ms" },
+	{ "CKSEL=11 SUT=10", "Int. RC Osc. 128 kHz; Start-up time: 14 CK + 64 ms" },
+	{ "CKSEL=01 SUT=00", "Int. RC Osc. 4.8 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=01 SUT=01", "Int. RC Osc. 4.8 MHz; Start-up time: 14 CK + 4 ms" },
+	{ "CKSEL=01 SUT=10", "Int. RC Osc. 4.8 MHz; Start-up time: 14 CK + 64 ms" },
+	{ "CKSEL=10 SUT=00", "Int. RC Osc. 9.6 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=10 SUT=01", "Int. RC Osc. 9.6 MHz; Start-up time: 14 CK + 4 ms" },
+	{ "CKSEL=10 SUT=10", "Int. RC Osc. 9.6 MHz; Start-up time: 14 CK + 64 ms" },
+
+	{ "BODLEVEL=11", "Brown-out detection disabled" },
+	{ "BODLEVEL=10", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=01", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=00", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny13_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny13_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny15
+static constexpr FuseBitDef attiny15_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 4, "RSTDISBL", "External reset function of PB5 disabled" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" }
+};
+
+static constexpr FuseMaskDef attiny15_fusedescr[] =
+{
+	{ "CKSEL=00", "Slowly rising power" },
+	{ "CKSEL=01", "Slowly rising power" },
+	{ "CKSEL=10", "Quickly rising power" },
+	{ "CKSEL=11", "Very quickly rising power" }
+};
+
+static constexpr FuseBitDef attiny15_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny15_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny22
+static constexpr FuseBitDef attiny22_fuse[] =
+{
+	{ 0, "/FB0", "NOT External clock disabled" }, // NOT enabled
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseBitDef attiny22_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny22_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny26
+static constexpr FuseBitDef attiny26_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses)" },
+	{ 7, "PLLCK0", "" },
+	{ 8, "BODEN", "Brown-out detection enabled" },
+	{ 9, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 10, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 11, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 12, "RSTDISBL", "Reset Disabled (Enable PB7 as i/o pin)" }
+};
+
+static constexpr FuseMaskDef attiny26_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00 PLLCK=1", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01 PLLCK=1", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10 PLLCK=1", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01 PLLCK=1", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01 PLLCK=1", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01 PLLCK=1", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00 PLLCK=1", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01 PLLCK=1", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10 PLLCK=1", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00 PLLCK=1", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01 PLLCK=1", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10 PLLCK=1", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11 PLLCK=1", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00 PLLCK=1", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01 PLLCK=1", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10 PLLCK=1", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11 PLLCK=1", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00 PLLCK=1", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01 PLLCK=1", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10 PLLCK=1", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11 PLLCK=1", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00 PLLCK=1", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01 PLLCK=1", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10 PLLCK=1", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11 PLLCK=1", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00 PLLCK=1", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01 PLLCK=1", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10 PLLCK=1", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00 PLLCK=1", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01 PLLCK=1", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10 PLLCK=1", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00 PLLCK=1", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01 PLLCK=1", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10 PLLCK=1", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00 PLLCK=1", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01 PLLCK=1", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10 PLLCK=1", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=11 PLLCK=0", "PLL Clock; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=0001 SUT=00 PLLCK=0", "PLL Clock; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01 PLLCK=0", "PLL Clock; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10 PLLCK=0", "PLL Clock; Start-up time: 1K CK + 64 ms" }
+};
+
+static constexpr FuseBitDef attiny26_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny26_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny2313
+static constexpr FuseBitDef attiny2313_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTD2" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "RSTDISBL", "Reset Disabled (Enable PA2 as i/o pin)" },
+	{ 9, "BODLEVEL0", "" },
+	{ 10, "BODLEVEL1", "" },
+	{ 11, "BODLEVEL2", "" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 15, "DWEN", "Debug Wire enable" },
+	{ 16, "SELFPRGEN", "Self programming enable" }
+};
+
+static constexpr FuseMaskDef attiny2313_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=00", "Int. RC Osc. 128 kHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Int. RC Osc. 128 kHz; Start-up time: 14 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Int. RC Osc. 128 kHz; Start-up time: 14 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 14 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 14 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 14 CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 14 CK + 65 ms" },
+
+	{ "BODLEVEL=11", "Brown-out detection disabled" },
+	{ "BODLEVEL=10", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=01", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=00", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny2313_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny2313_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny25
+static constexpr FuseBitDef attiny25_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB4" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PB5 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef attiny25_fusedescr[] =
+{
+	{ "CKSEL=0011 SUT=11", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 1 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=10", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=00", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=01", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=01", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=11", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=00", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny25_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny25_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny45
+static constexpr FuseBitDef attiny45_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB4" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PB5 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef attiny45_fusedescr[] =
+{
+	{ "CKSEL=0011 SUT=11", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 1 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=10", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=00", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=01", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=01", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=11", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=00", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny45_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny45_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny85
+static constexpr FuseBitDef attiny85_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB4" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PB5 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef attiny85_fusedescr[] =
+{
+	{ "CKSEL=0011 SUT=11", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 1 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=10", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=00", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=01", "ATtiny15 Comp: Int. RC Osc. 6.4 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=01", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=11", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=00", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny85_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny85_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny261
+static constexpr FuseBitDef attiny261_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB5" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PB7 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef attiny261_fusedescr[] =
+{
+	{ "CKSEL=1000 SUT=10", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1 CK 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=11", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 68 ms" },
+	{ "CKSEL=0001 SUT=01", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 8 ms" },
+	{ "CKSEL=0001 SUT=10", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 68 ms" },
+	{ "CKSEL=0001 SUT=00", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 8 ms" },
+	{ "CKSEL=0011 SUT=00", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+
+	// brown out
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=001", "Brown-out detection level at VCC=1.9 V" },
+	{ "BODLEVEL=000", "Brown-out detection level at VCC=2.0 V" },
+	{ "BODLEVEL=010", "Brown-out detection level at VCC=2.2 V" },
+	{ "BODLEVEL=011", "Brown-out detection level at VCC=2.3 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny261_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny261_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny461
+static constexpr FuseBitDef attiny461_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB5" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PB7 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef attiny461_fusedescr[] =
+{
+	{ "CKSEL=1000 SUT=10", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1 CK 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=11", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 68 ms" },
+	{ "CKSEL=0001 SUT=01", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 8 ms" },
+	{ "CKSEL=0001 SUT=10", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 68 ms" },
+	{ "CKSEL=0001 SUT=00", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 8 ms" },
+	{ "CKSEL=0011 SUT=00", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+
+	// brown out
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=001", "Brown-out detection level at VCC=1.9 V" },
+	{ "BODLEVEL=000", "Brown-out detection level at VCC=2.0 V" },
+	{ "BODLEVEL=010", "Brown-out detection level at VCC=2.2 V" },
+	{ "BODLEVEL=011", "Brown-out detection level at VCC=2.3 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny461_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny461_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATtiny861
+static constexpr FuseBitDef attiny861_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB5" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PB7 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef attiny861_fusedescr[] =
+{
+	{ "CKSEL=1000 SUT=10", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Ceramic Res.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Ceramic Res.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Ceramic Res.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Ceramic Res.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1 CK 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+	{ "CKSEL=0001 SUT=11", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 68 ms" },
+	{ "CKSEL=0001 SUT=01", "PLL Clock; Start-up time PWRDWN/RESET: 16K CK/14 CK + 8 ms" },
+	{ "CKSEL=0001 SUT=10", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 68 ms" },
+	{ "CKSEL=0001 SUT=00", "PLL Clock; Start-up time PWRDWN/RESET: 1K CK/14 CK + 8 ms" },
+	{ "CKSEL=0011 SUT=00", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "WD. Osc. 128 kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 64 ms" },
+
+	// brown out
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=001", "Brown-out detection level at VCC=1.9 V" },
+	{ "BODLEVEL=000", "Brown-out detection level at VCC=2.0 V" },
+	{ "BODLEVEL=010", "Brown-out detection level at VCC=2.2 V" },
+	{ "BODLEVEL=011", "Brown-out detection level at VCC=2.3 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef attiny861_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef attiny861_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATmega48
+static constexpr FuseBitDef atmega48_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB0" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PB6 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef atmega48_fusedescr[] =
+{
+	{ "CKSEL=1100 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=00", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=01", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=10", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega48_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef atmega48_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATmega88
+static constexpr FuseBitDef atmega88_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB0" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PC6 as i/o pin)" },
+	{ 16, "SELFPRGEN", "Self Programming enable" }
+};
+
+static constexpr FuseMaskDef atmega88_fusedescr[] =
+{
+	{ "CKSEL=1100 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=00", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=01", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=10", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega88_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef atmega88_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATmega168
+static constexpr FuseBitDef atmega168_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB0" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BODLEVEL0", "" },
+	{ 9, "BODLEVEL1", "" },
+	{ 10, "BODLEVEL2", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PC6 as i/o pin)" },
+	{ 16, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 17, "BOOTSZ0", "" },
+	{ 18, "BOOTSZ1", "" }
+};
+
+static constexpr FuseMaskDef atmega168_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 65 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" },
+
+	// extended
+	{ "BOOTSZ=00", "Boot Flash section size=1024 words Boot start address=$1C00" },
+	{ "BOOTSZ=11", "Boot Flash section size=128 words Boot start address=$1F80" },
+	{ "BOOTSZ=10", "Boot Flash section size=256 words Boot start address=$1F00" },
+	{ "BOOTSZ=01", "Boot Flash section size=512 words Boot start address=$1E00" }
+};
+
+static constexpr FuseBitDef atmega168_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega168_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega328
+static constexpr FuseBitDef atmega328_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB0" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "DWEN", "Debug Wire enable" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PC6 as i/o pin)" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega328_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 16K CK/14 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 16K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 16K CK/14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 1K CK /14 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 1K CK /14 CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 1K CK /14 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 258 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Full-swing Crystal; Start-up time PWRDWN/RESET: 258 CK/14 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 1K CK/14 CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time PWRDWN/RESET: 32K CK/14 CK + 65 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 128kHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 8 MHz; Start-up time PWRDWN/RESET: 6 CK/14 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$3C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$3800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$3F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$3E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega328_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega328_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega164
+static constexpr FuseBitDef atmega164_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB1" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega164_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$3C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$3800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$3F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$3E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega164_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega164_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega324
+static constexpr FuseBitDef atmega324_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB1" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega324_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$3C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$3800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$3F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$3E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega324_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega324_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega644
+static constexpr FuseBitDef atmega644_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB1" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega644_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$7F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$7E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega644_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega644_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega640
+static constexpr FuseBitDef atmega640_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTE7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega640_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$7F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$7E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega640_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega640_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega1280
+static constexpr FuseBitDef atmega1280_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTE7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega1280_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$7F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$7E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega1280_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega1280_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega1281
+static constexpr FuseBitDef atmega1281_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTE7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega1281_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$7F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$7E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega1281_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega1281_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega2560
+static constexpr FuseBitDef atmega2560_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTE7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega2560_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$7F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$7E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega2560_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega2560_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega2561
+static constexpr FuseBitDef atmega2561_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTE7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watch-dog Timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "BODLEVEL0", "" },
+	{ 17, "BODLEVEL1", "" },
+	{ 18, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega2561_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=01", "Full Swing Oscillator; Start-up time: 16K CK + 0 ms; Crystal Osc.; BOD enabled" },
+	{ "CKSEL=0111 SUT=10", "Full Swing Oscillator; Start-up time: 16K CK + 4.1 ms; Crystal Osc.; fast rising power" },
+	{ "CKSEL=0111 SUT=11", "Full Swing Oscillator; Start-up time: 16K CK + 65 ms; Crystal Osc.; slowly rising power" },
+	{ "CKSEL=0110 SUT=10", "Full Swing Oscillator; Start-up time: 1K CK + 0 ms; Ceramic res.; BOD enable" },
+	{ "CKSEL=0110 SUT=11", "Full Swing Oscillator; Start-up time: 1K CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0111 SUT=00", "Full Swing Oscillator; Start-up time: 1K CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0110 SUT=00", "Full Swing Oscillator; Start-up time: 258 CK + 4.1 ms; Ceramic res.; fast rising power" },
+	{ "CKSEL=0110 SUT=01", "Full Swing Oscillator; Start-up time: 258 CK + 65 ms; Ceramic res.; slowly rising power" },
+	{ "CKSEL=0011 SUT=00", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. 128kHz RC Osc.; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$7F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$7E00" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" }
+};
+
+static constexpr FuseBitDef atmega2561_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega2561_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega603 ???
+static constexpr FuseBitDef atmega603_fuse[] =
+{
+	{ 0, "SUT0", "" },
+	{ 1, "SUT1", "" },
+	{ 3, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseMaskDef atmega603_fusedescr[] =
+{
+	{ "SUT=00", "Start-up time=5 CPU cycles" },
+	{ "SUT=01", "Start-up time=0.5 ms" },
+	{ "SUT=10", "Start-up time=4.0 ms" },
+	{ "SUT=11", "Start-up time=16.0 ms" }
+};
+
+static constexpr FuseBitDef atmega603_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef atmega603_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATmega103
+static constexpr FuseBitDef atmega103_fuse[] =
+{
+	{ 0, "SUT0", "" },
+	{ 1, "SUT1", "" },
+	{ 3, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" }
+};
+
+static constexpr FuseMaskDef atmega103_fusedescr[] =
+{
+	{ "SUT=00", "Start-up time=5 CPU cycles" },
+	{ "SUT=01", "Start-up time=0.5 ms" },
+	{ "SUT=10", "Start-up time=4.0 ms" },
+	{ "SUT=11", "Start-up time=16.0 ms" }
+};
+
+static constexpr FuseBitDef atmega103_lock[] =
+{
+	{ 1, "Lock1", "" },
+	{ 2, "Lock2", "" }
+};
+
+static constexpr FuseMaskDef atmega103_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" }
+};
+
+//ATmega8
+static constexpr FuseBitDef atmega8_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "WDTON", "Watch-dog Timer always on" },
+	{ 15, "RSTDISBL", "Reset Disabled (Enable PC6 as i/o pin)" }
+};
+
+static constexpr FuseMaskDef atmega8_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$0C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$0800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$0F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$0E00" }
+};
+
+static constexpr FuseBitDef atmega8_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega8_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega8515
+static constexpr FuseBitDef atmega8515_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses)" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "WDTON", "Watch-dog Timer always on" },
+	{ 15, "S8515C", "AT90S4414/8515 compatibility mode" }
+};
+
+static constexpr FuseMaskDef atmega8515_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$0C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$0800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$0F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$0E00" }
+};
+
+static constexpr FuseBitDef atmega8515_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega8515_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega8535
+static constexpr FuseBitDef atmega8535_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses)" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "WDTON", "Watch-dog Timer always on" },
+	{ 15, "S8515C", "AT90S4414/8515 compatibility mode" }
+};
+
+static constexpr FuseMaskDef atmega8535_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$0C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$0800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$0F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$0E00" }
+};
+
+static constexpr FuseBitDef atmega8535_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega8535_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega64
+static constexpr FuseBitDef atmega64_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses)" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "WDTON", "Watchdog Timer always on" },
+	{ 17, "M103C", "ATmega103 Compatibility Mode" }
+};
+
+static constexpr FuseMaskDef atmega64_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$7C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$7800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$7F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$7E00" }
+};
+
+static constexpr FuseBitDef atmega64_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega64_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega128
+static constexpr FuseBitDef atmega128_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses)" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "WDTON", "Watchdog Timer always on" },
+	{ 17, "M103C", "ATmega103 Compatibility Mode" }
+};
+
+static constexpr FuseMaskDef atmega128_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$FC00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$F800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$FF00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$FE00" }
+};
+
+static constexpr FuseBitDef atmega128_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega128_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega16
+static constexpr FuseBitDef atmega16_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses)" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" }
+};
+
+static constexpr FuseMaskDef atmega16_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$1C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$1800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$1F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$1E00" }
+};
+
+static constexpr FuseBitDef atmega16_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega16_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega161
+static constexpr FuseBitDef atmega161_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "SUT", "Start-up time" },
+	{ 4, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 5, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" }
+};
+
+static constexpr FuseMaskDef atmega161_fusedescr[] =
+{
+	{ "CKSEL=000", "External Clock; fast rising power" },
+	{ "CKSEL=001", "External Clock; BOD Enabled or power-on reset" },
+	{ "CKSEL=010", "Crystal Oscillator; slowly rising power" },
+	{ "CKSEL=011", "Crystal Oscillator; fast rising power" },
+	{ "CKSEL=100", "Crystal Oscillator; BOD Enabled or power-on reset" },
+	{ "CKSEL=101", "Ceramic Resonator / External Clock; Slowly rising power" },
+	{ "CKSEL=110", "Ceramic Resonator; fast rising power" },
+	{ "CKSEL=111", "Ceramic Resonator; BOD Enabled or power-on reset" }
+};
+
+static constexpr FuseBitDef atmega161_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega161_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega163
+static constexpr FuseBitDef atmega163_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 5, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" }
+};
+
+static constexpr FuseMaskDef atmega163_fusedescr[] =
+{
+	{ "CKSEL=0000", "External Clock fast rising power" },
+	{ "CKSEL=0001", "External Clock BOD enabled" },
+	{ "CKSEL=0010", "Internal RC Ocsillator slowly rising power" },
+	{ "CKSEL=0011", "Internal RC Ocsillator fast rising power" },
+	{ "CKSEL=0100", "Internal RC Oscillator BOD enabled" },
+	{ "CKSEL=0101", "External RC Oscillator slowly rising power" },
+	{ "CKSEL=0110", "External RC Oscillator fast rising power" },
+	{ "CKSEL=0111", "External RC Oscillator BOD enabled" },
+	{ "CKSEL=1000", "External Low-Frequency Crystal" },
+	{ "CKSEL=1001", "External Low-Frequency Crystal" },
+	{ "CKSEL=1010", "Crystal Oscillator slowly rising power" },
+	{ "CKSEL=1011", "Crystal Oscillator fast rising power" },
+	{ "CKSEL=1100", "Crystal Oscillator BOD enabled" },
+	{ "CKSEL=1101", "Ceramic Resonator/External Clock slowly rising power" },
+	{ "CKSEL=1110", "Ceramic Resonator fast rising power" },
+	{ "CKSEL=1111", "Ceramic Resonator BOD enabled" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$1C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$1800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$1F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$1E00" }
+};
+
+static constexpr FuseBitDef atmega163_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega163_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega162
+static constexpr FuseBitDef atmega162_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTB0" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watchdog timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 17, "BODLEVEL0", "" },
+	{ 18, "BODLEVEL1", "" },
+	{ 19, "BODLEVEL1", "" },
+	{ 20, "M161C", "ATmega161 compability mode" }
+};
+
+static constexpr FuseMaskDef atmega162_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0100 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0100 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms; Int. Cap." },
+	{ "CKSEL=0101 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms; Int. Cap." },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$1C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$1800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$1F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$1E00" }
+};
+
+static constexpr FuseBitDef atmega162_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega162_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega169
+static constexpr FuseBitDef atmega169_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "CKOUT", "Clock output on PORTE7" },
+	{ 7, "CKDIV8", "Divide clock by 8 internally" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "WDTON", "Watchdog timer always on" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" },
+	{ 16, "RSTDISBL", "Reset Disabled (Enable PG5 as i/o pin)" },
+	{ 17, "BODLEVEL0", "" },
+	{ 18, "BODLEVEL1", "" },
+	{ 19, "BODLEVEL2", "" }
+};
+
+static constexpr FuseMaskDef atmega169_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 65 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. Crystal Osc.; Frequency 0.4-0.9 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal Osc.; Frequency 0.9-3.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal Osc.; Frequency 3.0-8.0 MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 16K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 4.1 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal Osc.; Frequency 8.0- MHz; Start-up time: 258 CK + 65 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4.1 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 65 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 4.1 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 65 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc.; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc.; Start-up time: 6 CK + 4.1 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc.; Start-up time: 6 CK + 65 ms" },
+
+	{ "BODLEVEL=111", "Brown-out detection disabled" },
+	{ "BODLEVEL=110", "Brown-out detection level at VCC=1.8 V" },
+	{ "BODLEVEL=101", "Brown-out detection level at VCC=2.7 V" },
+	{ "BODLEVEL=100", "Brown-out detection level at VCC=4.3 V" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$1C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$1800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$1F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$1E00" }
+};
+
+static constexpr FuseBitDef atmega169_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega169_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega323
+static constexpr FuseBitDef atmega323_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory during through Chip Erase Cycle" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" }
+};
+
+static constexpr FuseMaskDef atmega323_fusedescr[] =
+{
+	{ "CKSEL=0000", "External Clock fast rising power" },
+	{ "CKSEL=0001", "External Clock BOD enabled" },
+	{ "CKSEL=0010", "Internal RC Ocsillator slowly rising power" },
+	{ "CKSEL=0011", "Internal RC Ocsillator fast rising power" },
+	{ "CKSEL=0100", "Internal RC Oscillator BOD enabled" },
+	{ "CKSEL=0101", "External RC Oscillator slowly rising power" },
+	{ "CKSEL=0110", "External RC Oscillator fast rising power" },
+	{ "CKSEL=0111", "External RC Oscillator BOD enabled" },
+	{ "CKSEL=1000", "External Low-Frequency Crystal" },
+	{ "CKSEL=1001", "External Low-Frequency Crystal" },
+	{ "CKSEL=1010", "Crystal Oscillator slowly rising power" },
+	{ "CKSEL=1011", "Crystal Oscillator fast rising power" },
+	{ "CKSEL=1100", "Crystal Oscillator BOD enabled" },
+	{ "CKSEL=1101", "Ceramic Resonator/External Clock slowly rising power" },
+	{ "CKSEL=1110", "Ceramic Resonator fast rising power" },
+	{ "CKSEL=1111", "Ceramic Resonator BOD enabled" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$3C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$3800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$3F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$3E00" }
+};
+
+static constexpr FuseBitDef atmega323_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega323_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//ATmega32
+static constexpr FuseBitDef atmega32_fuse[] =
+{
+	{ 0, "CKSEL0", "" },
+	{ 1, "CKSEL1", "" },
+	{ 2, "CKSEL2", "" },
+	{ 3, "CKSEL3", "" },
+	{ 4, "SUT0", "" },
+	{ 5, "SUT1", "" },
+	{ 6, "BODEN", "Brown-out detection enabled" },
+	{ 7, "/BODLEVEL", "NOT Brown-out detection level at VCC=2.7 V" },
+	{ 8, "BOOTRST", "Boot Reset vector Enabled (default address=$0000)" },
+	{ 9, "BOOTSZ0", "" },
+	{ 10, "BOOTSZ1", "" },
+	{ 11, "EESAVE", "Preserve EEPROM memory through the Chip Erase cycle" },
+	{ 12, "CKOPT", "CKOPT fuse (operation dependent of CKSEL fuses)" },
+	{ 13, "SPIEN", "Serial program downloading (SPI) enabled" },
+	{ 14, "JTAGEN", "JTAG Interface Enabled" },
+	{ 15, "OCDEN", "On-Chip Debug Enabled" }
+};
+
+static constexpr FuseMaskDef atmega32_fusedescr[] =
+{
+	{ "CKSEL=0000 SUT=00", "Ext. Clock; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0000 SUT=01", "Ext. Clock; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0000 SUT=10", "Ext. Clock; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=1111 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1111 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=10", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1110 SUT=11", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1111 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1110 SUT=00", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1110 SUT=01", "Ext. Crystal/Resonator High Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1011 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1011 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=10", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1010 SUT=11", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1011 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1010 SUT=00", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1010 SUT=01", "Ext. Crystal/Resonator Low Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1101 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 0 ms" },
+	{ "CKSEL=1101 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 16K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=10", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 0 ms" },
+	{ "CKSEL=1100 SUT=11", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1101 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1100 SUT=00", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 4 ms" },
+	{ "CKSEL=1100 SUT=01", "Ext. Crystal/Resonator Medium Freq.; Start-up time: 258 CK + 64 ms" },
+	{ "CKSEL=1001 SUT=00", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 4 ms" },
+	{ "CKSEL=1001 SUT=01", "Ext. Low-Freq. Crystal; Start-up time: 1K CK + 64 ms" },
+	{ "CKSEL=1001 SUT=10", "Ext. Low-Freq. Crystal; Start-up time: 32K CK + 64 ms" },
+	{ "CKSEL=0101 SUT=00", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0101 SUT=01", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0101 SUT=10", "Ext. RC Osc. - 0.9 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0101 SUT=11", "Ext. RC Osc. - 0.9 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=00", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0110 SUT=01", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0110 SUT=10", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0110 SUT=11", "Ext. RC Osc. 0.9 MHz - 3.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=00", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=0111 SUT=01", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=0111 SUT=10", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=0111 SUT=11", "Ext. RC Osc. 3.0 MHz - 8.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=00", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 0 ms" },
+	{ "CKSEL=1000 SUT=01", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 4 ms" },
+	{ "CKSEL=1000 SUT=10", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 18 CK + 64 ms" },
+	{ "CKSEL=1000 SUT=11", "Ext. RC Osc. 8.0 MHz - 12.0 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=00", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0001 SUT=01", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0001 SUT=10", "Int. RC Osc. 1 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0010 SUT=00", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0010 SUT=01", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0010 SUT=10", "Int. RC Osc. 2 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0011 SUT=00", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0011 SUT=01", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0011 SUT=10", "Int. RC Osc. 4 MHz; Start-up time: 6 CK + 64 ms" },
+	{ "CKSEL=0100 SUT=00", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 0 ms" },
+	{ "CKSEL=0100 SUT=01", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 4 ms" },
+	{ "CKSEL=0100 SUT=10", "Int. RC Osc. 8 MHz; Start-up time: 6 CK + 64 ms" },
+
+	{ "BOOTSZ=01", "Boot Flash section size=1024 words Boot start address=$3C00" },
+	{ "BOOTSZ=00", "Boot Flash section size=2048 words Boot start address=$3800" },
+	{ "BOOTSZ=11", "Boot Flash section size=256 words Boot start address=$3F00" },
+	{ "BOOTSZ=10", "Boot Flash section size=512 words Boot start address=$3E00" }
+};
+
+static constexpr FuseBitDef atmega32_lock[] =
+{
+	{ 0, "Lock1", "" },
+	{ 1, "Lock2", "" },
+	{ 2, "BootLock1", "" },
+	{ 3, "BootLock2", "" },
+	{ 4, "BootLoad1", "" },
+	{ 5, "BootLoad2", "" }
+};
+
+static constexpr FuseMaskDef atmega32_lockdescr[] =
+{
+	{ "Lock=11", "Mode 1: No memory lock features enabled" },
+	{ "Lock=10", "Mode 2: Further programming disabled" },
+	{ "Lock=00", "Mode 3: Further programming and verification disabled" },
+
+	{ "BootLock=11", "Application Protection Mode 1: No lock on SPM and LPM in Application Section" },
+	{ "BootLock=10", "Application Protection Mode 2: SPM prohibited in Application Section" },
+	{ "BootLock=00", "Application Protection Mode 3: LPM and SPM prohibited in Application Section" },
+	{ "BootLock=01", "Application Protection Mode 4: LPM prohibited in Application Section" },
+
+	{ "BootLoad=11", "Boot Loader Protection Mode 1: No lock on SPM and LPM in Boot Loader Section" },
+	{ "BootLoad=10", "Boot Loader Protection Mode 2: SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=00", "Boot Loader Protection Mode 3: LPM and SPM prohibited in Boot Loader Section" },
+	{ "BootLoad=01", "Boot Loader Protection Mode 4: LPM prohibited in Boot Loader Section" }
+};
+
+//PIC12508, PIC12509, PIC12508A, PIC12509A, PIC12E518, PIC12E519
+static constexpr FuseBitDef pic12508_lock[] =
+{
+	{ 0, "FOSC0", "" },
+	{ 1, "FOSC1", "" },
+	{ 2, "WDTE", "Watchdog timer enable" },
+	{ 3, "CP", "Code protection bit" },
+	{ 4, "/MCLRE", "NOT MCLR enable bit" }
+};
+
+static constexpr FuseMaskDef pic12508_lockdescr[] =
+{
+	{ "FOSC=11", "EXTRC - external RC oscillator" },
+	{ "FOSC=10", "INTRC - internal RC oscillator" },
+	{ "FOSC=01", "XT oscillator" },
+	{ "FOSC=00", "LP oscillator" }
+};
+
+//PIC12671, PIC12672, PIC12673, PIC12674
+static constexpr FuseBitDef pic12671_lock[] =
+{
+	{ 0, "FOSC0", "" },
+	{ 1, "FOSC1", "" },
+	{ 2, "FOSC2", "" },
+	{ 3, "WDTE", "Watchdog Timer Enable" },
+	{ 4, "/PWRTE", "NOT Power-up Timer Enable" },
+	{ 5, "CP0", "" },
+	{ 6, "CP1", "" },
+	{ 7, "MCLRE", "Master Clear Reset Enable" },
+	{ 8, "CP0", "" },
+	{ 9, "CP1", "" },
+	{ 10, "CP0", "" },
+	{ 11, "CP1", "" },
+	{ 12, "CP0", "" },
+	{ 13, "CP1", "" }
+};
+
+static constexpr FuseMaskDef pic12671_lockdescr[] =
+{
+	{ "FOSC=111", "EXTRC, Clockout on OSC2" },
+	{ "FOSC=110", "EXTRC, OSC2 is I/O" },
+	{ "FOSC=101", "INTRC, Clockout on OSC2" },
+	{ "FOSC=100", "INTRC, OSC2 is I/O" },
+	{ "FOSC=011", "Invalid Selection" },
+	{ "FOSC=010", "HS Oscillator" },
+	{ "FOSC=001", "XT Oscillator" },
+	{ "FOSC=000", "LP Oscillator" },
+
+	{ "CP=11", "Code protection off" },
+	{ "CP=10", "Locations 400h through 7FEh code protected" },
+	{ "CP=01", "Locations 200h through 7FEh code protected" },
+	{ "CP=00", "All memory is code protected" }
+};
+
+//PIC1683, PIC1684, PIC1684A
+static constexpr FuseBitDef pic1683_lock[] =
+{
+	{ 0, "FOSC0", "" },
+	{ 1, "FOSC1", "" },
+	{ 2, "WDTE", "Watchdog timer enable" },
+	{ 3, "/PWRTE", "NOT Power-up Timer Enable" },
+	{ 4, "CP", "Code protection" }
+};
+
+static constexpr FuseMaskDef pic1683_lockdescr[] =
+{
+	{ "FOSC=11", "EXTRC - external RC oscillator" },
+	{ "FOSC=10", "INTRC - internal RC oscillator" },
+	{ "FOSC=01", "XT oscillator" },
+	{ "FOSC=00", "LP oscillator" }
+};
+
+//PIC16870, PIC16871, PIC16872, PIC16873, PIC16874, PIC16876, PIC16877
+static constexpr FuseBitDef pic16870_lock[] =
+{
+	{ 0, "FOSC0", "" },
+	{ 1, "FOSC1", "" },
+	{ 2, "WDTE", "Watchdog Timer Enable" },
+	{ 3, "/PWRTE", "NOT Power-up Timer Enable" },
+	{ 4, "CP0", "" },
+	{ 5, "CP1", "" },
+	{ 6, "BODEN", "Brown-out Reset Enable" },
+	{ 7, "LVP", "Low Voltage In-Circuit Serial Programming Enable" },
+	{ 8, "CPD", "Data EE Memory Code Protection" },
+	{ 9, "WRT", "FLASH Program Memory Write Enable" },
+	{ 11, "DEBUG", "In-Circuit Debugger Mode" },
+	{ 12, "CP0", "" },
+	{ 13, "CP1", "" }
+};
+
+static constexpr FuseMaskDef pic16870_lockdescr[] =
+{
+	{ "FOSC=11", "RC oscillator" },
+	{ "FOSC=10", "HS oscillator" },
+	{ "FOSC=01", "XT oscillator" },
+	{ "FOSC=00", "LP oscillator" },
+
+	{ "CP=11", "Code protection off" },
+	{ "CP=10", "1F00h to 1FFFh code protected" },
+	{ "CP=01", "1000h to 1FFFh code protected" },
+	{ "CP=00", "0000h to 1FFFh code protected" }
+};
+
+//PIC16873A, PIC16874A, PIC16876A, PIC16877A
+static constexpr FuseBitDef pic16873a_lock[] =
+{
+	{ 0, "FOSC0", "" },
+	{ 1, "FOSC1", "" },
+	{ 2, "WDTEN", "Watchdog Timer Enable" },
+	{ 3, "/PWRTEN", "NOT Power-up Timer Enable" },
+	{ 6, "BOREN", "Brown-out Reset Enable" },
+	{ 7, "LVP", "Low-Voltage (Single-Supply)" },
+	{ 8, "CPD", "Data EEPROM Memory Code Protection" },
+	{ 9, "WRT0", "" },
+	{ 11, "WRT1", "" },
+	{ 12, "DEBUG", "In-Circuit Debugger Mode" },
+	{ 14, "CP", "Flash Program Memory Code Protection" }
+};
+
+static constexpr FuseMaskDef pic16873a_lockdescr[] =
+{
+	{ "FOSC=11", "RC oscillator" },
+	{ "FOSC=10", "HS oscillator" },
+	{ "FOSC=01", "XT oscillator" },
+	{ "FOSC=00", "LP oscillator" },
+
+	{ "WRT=11", "Write protection off; all program memory may be written to by EECON control" },
+	{ "WRT=10", "0000h to 00FFh write-protected; 0100h to 0FFFh may be written to by EECON control" },
+	{ "WRT=01", "0000h to 03FFh write-protected; 0400h to 0FFFh may be written to by EECON control" },
+	{ "WRT=11", "0000h to 07FFh write-protected; 0800h to 0FFFh may be written to by EECON control" }
+};
+
+//PIC16627, PIC16628
+static constexpr FuseBitDef pic16627_lock[] =
+{
+	{ 0, "FOSC0", "" },
+	{ 1, "FOSC1", "" },
+	{ 2, "WDTEN", "Watchdog Timer Enable" },
+	{ 3, "/PWRTEN", "NOT Power-up Timer Enable" },
+	{ 4, "FOSC2", "" },
+	{ 5, "MCLRE", "RA5/MCLR pin function select" },
+	{ 6, "BOREN", "Brown-out Detect Reset Enable" },
+	{ 7, "LVP", "Low Voltage Programming Enable" },
+	{ 8, "CPD", "Data Code Protection" },
+	{ 10, "CP0", "" },
+	{ 11, "CP1", "" },
+	{ 12, "CP0", "" },
+	{ 13, "CP1", "" }
+};
+
+static constexpr FuseMaskDef pic16627_lockdescr[] =
+{
+	{ "FOSC=111", "ER oscillator: CLKOUT function on RA6/OSC2/CLKOUT pin, Resistor on RA7/OSC1/CLKIN" },
+	{ "FOSC=110", "ER oscillator: I/O function on RA6/OSC2/CLKOUT pin, Resistor on RA7/OSC1/CLKIN" },
+	{ "FOSC=101", "INTRC oscillator: CLKOUT function on RA6/OSC2/CLKOUT pin, I/O function on RA7/OSC1/CLKIN" },
+	{ "FOSC=100", "INTRC oscillator: I/O function on RA6/OSC2/CLKOUT pin, I/O function on RA7/OSC1/CLKIN" },
+	{ "FOSC=011", "EC: I/O function on RA6/OSC2/CLKOUT pin, CLKIN on RA7/OSC1/CLKIN" },
+	{ "FOSC=010", "HS oscillator: High speed crystal/resonator on RA6/OSC2/CLKOUT and RA7/OSC1/CLKIN" },
+	{ "FOSC=001", "XT oscillator: Crystal/resonator on RA6/OSC2/CLKOUT and RA7/OSC1/CLKIN" },
+	{ "FOSC=000", "LP oscillator: Low power crystal on RA6/OSC2/CLKOUT and RA7/OSC1/CLKIN" },
+
+	{ "CP=11", "Program memory code protection off" },
+	{ "CP=10", "Program memory code protection off" },
+	{ "CP=01", "0200h-03FFh code protected" },
+	{ "CP=00", "0000h-03FFh code protected" }
+};
+
+
+static constexpr ChipBitsDef chip_bits[] =
+{
+	{ { NOBITS, NOBITS }, { BITS(at89s8252_lock), BITS(at89s8252_lockdescr) } },		//0 AT89S8252, AT89S53
+	{ { BITS(at89s8253_fuse), NOBITS }, { BITS(at89s8253_lock), BITS(at89s8253_lockdescr) } },		//1 AT89S8253
+	{ { NOBITS, NOBITS }, { BITS(at89s51_lock), BITS(at89s51_lockdescr) } },		//2 AT89S51, AT89S52
+	{ { BITS(at90can32_fuse), BITS(at90can32_fusedescr) }, { BITS(at90can32_lock), BITS(at90can32_lockdescr) } },		//3 AT90CAN32
+	{ { BITS(at90can64_fuse), BITS(at90can64_fusedescr) }, { BITS(at90can64_lock), BITS(at90can64_lockdescr) } },		//4 AT90CAN64
+	{ { BITS(at90can128_fuse), BITS(at90can128_fusedescr) }, { BITS(at90can128_lock), BITS(at90can128_lockdescr) } },		//5 AT90CAN128
+	{ { BITS(at90s1200_fuse), NOBITS }, { BITS(at90s1200_lock), BITS(at90s1200_lockdescr) } },		//6 AT90S1200
+	{ { BITS(at90s2313_fuse), NOBITS }, { BITS(at90s2313_lock), BITS(at90s2313_lockdescr) } },		//7 AT90S2313, AT90S4414, AT90S8515, AT90S4434, AT90S8535
+	{ { BITS(at90s2333_fuse), NOBITS }, { BITS(at90s2333_lock), BITS(at90s2333_lockdescr) } },		//8 AT90S2333
+	{ { BITS(at90s4433_fuse), BITS(at90s4433_fusedescr) }, { BITS(at90s4433_lock), BITS(at90s4433_lockdescr) } },		//9 AT90S4433
+	{ { BITS(at90s2323_fuse), NOBITS }, { BITS(at90s2323_lock), BITS(at90s2323_lockdescr) } },		//10 AT90S2323, AT90S8534
+	{ { BITS(at90s2343_fuse), NOBITS }, { BITS(at90s2343_lock), BITS(at90s2343_lockdescr) } },		//11 AT90S2343
+	{ { BITS(attiny12_fuse), BITS(attiny12_fusedescr) }, { BITS(attiny12_lock), BITS(attiny12_lockdescr) } },		//12 ATtiny12
+	{ { BITS(attiny13_fuse), BITS(attiny13_fusedescr) }, { BITS(attiny13_lock), BITS(attiny13_lockdescr) } },		//13 ATtiny13
+	{ { BITS(attiny15_fuse), BITS(attiny15_fusedescr) }, { BITS(attiny15_lock), BITS(attiny15_lockdescr) } },		//14 ATtiny15
+	{ { BITS(attiny22_fuse), NOBITS }, { BITS(attiny22_lock), BITS(attiny22_lockdescr) } },		//15 ATtiny22
+	{ { BITS(attiny26_fuse), BITS(attiny26_fusedescr) }, { BITS(attiny26_lock), BITS(attiny26_lockdescr) } },		//16 ATtiny26
+	{ { BITS(attiny2313_fuse), BITS(attiny2313_fusedescr) }, { BITS(attiny2313_lock), BITS(attiny2313_lockdescr) } },		//17 ATtiny2313
+	{ { BITS(attiny25_fuse), BITS(attiny25_fusedescr) }, { BITS(attiny25_lock), BITS(attiny25_lockdescr) } },		//18 ATtiny25
+	{ { BITS(attiny45_fuse), BITS(attiny45_fusedescr) }, { BITS(attiny45_lock), BITS(attiny45_lockdescr) } },		//19 ATtiny45
+	{ { BITS(attiny85_fuse), BITS(attiny85_fusedescr) }, { BITS(attiny85_lock), BITS(attiny85_lockdescr) } },		//20 ATtiny85
+	{ { BITS(attiny261_fuse), BITS(attiny261_fusedescr) }, { BITS(attiny261_lock), BITS(attiny261_lockdescr) } },		//21 ATtiny261
+	{ { BITS(attiny461_fuse), BITS(attiny461_fusedescr) }, { BITS(attiny461_lock), BITS(attiny461_lockdescr) } },		//22 ATtiny461
+	{ { BITS(attiny861_fuse), BITS(attiny861_fusedescr) }, { BITS(attiny861_lock), BITS(attiny861_lockdescr) } },		//23 ATtiny861
+	{ { BITS(atmega48_fuse), BITS(atmega48_fusedescr) }, { BITS(atmega48_lock), BITS(atmega48_lockdescr) } },		//24 ATmega48
+	{ { BITS(atmega88_fuse), BITS(atmega88_fusedescr) }, { BITS(atmega88_lock), BITS(atmega88_lockdescr) } },		//25 ATmega88
+	{ { BITS(atmega168_fuse), BITS(atmega168_fusedescr) }, { BITS(atmega168_lock), BITS(atmega168_lockdescr) } },		//26 ATmega168
+	{ { BITS(atmega328_fuse), BITS(atmega328_fusedescr) }, { BITS(atmega328_lock), BITS(atmega328_lockdescr) } },		//27 ATmega328
+	{ { BITS(atmega164_fuse), BITS(atmega164_fusedescr) }, { BITS(atmega164_lock), BITS(atmega164_lockdescr) } },		//28 ATmega164
+	{ { BITS(atmega324_fuse), BITS(atmega324_fusedescr) }, { BITS(atmega324_lock), BITS(atmega324_lockdescr) } },		//29 ATmega324
+	{ { BITS(atmega644_fuse), BITS(atmega644_fusedescr) }, { BITS(atmega644_lock), BITS(atmega644_lockdescr) } },		//30 ATmega644
+	{ { BITS(atmega640_fuse), BITS(atmega640_fusedescr) }, { BITS(atmega640_lock), BITS(atmega640_lockdescr) } },		//31 ATmega640
+	{ { BITS(atmega1280_fuse), BITS(atmega1280_fusedescr) }, { BITS(atmega1280_lock), BITS(atmega1280_lockdescr) } },		//32 ATmega1280
+	{ { BITS(atmega1281_fuse), BITS(atmega1281_fusedescr) }, { BITS(atmega1281_lock), BITS(atmega1281_lockdescr) } },		//33 ATmega1281
+	{ { BITS(atmega2560_fuse), BITS(atmega2560_fusedescr) }, { BITS(atmega2560_lock), BITS(atmega2560_lockdescr) } },		//34 ATmega2560
+	{ { BITS(atmega2561_fuse), BITS(atmega2561_fusedescr) }, { BITS(atmega2561_lock), BITS(atmega2561_lockdescr) } },		//35 ATmega2561
+	{ { BITS(atmega603_fuse), BITS(atmega603_fusedescr) }, { BITS(atmega603_lock), BITS(atmega603_lockdescr) } },		//36 ATmega603
+	{ { BITS(atmega103_fuse), BITS(atmega103_fusedescr) }, { BITS(atmega103_lock), BITS(atmega103_lockdescr) } },		//37 ATmega103
+	{ { BITS(atmega8_fuse), BITS(atmega8_fusedescr) }, { BITS(atmega8_lock), BITS(atmega8_lockdescr) } },		//38 ATmega8
+	{ { BITS(atmega8515_fuse), BITS(atmega8515_fusedescr) }, { BITS(atmega8515_lock), BITS(atmega8515_lockdescr) } },		//39 ATmega8515
+	{ { BITS(atmega8535_fuse), BITS(atmega8535_fusedescr) }, { BITS(atmega8535_lock), BITS(atmega8535_lockdescr) } },		//40 ATmega8535
+	{ { BITS(atmega64_fuse), BITS(atmega64_fusedescr) }, { BITS(atmega64_lock), BITS(atmega64_lockdescr) } },		//41 ATmega64
+	{ { BITS(atmega128_fuse), BITS(atmega128_fusedescr) }, { BITS(atmega128_lock), BITS(atmega128_lockdescr) } },		//42 ATmega128
+	{ { BITS(atmega16_fuse), BITS(atmega16_fusedescr) }, { BITS(atmega16_lock), BITS(atmega16_lockdescr) } },		//43 ATmega16
+	{ { BITS(atmega161_fuse), BITS(atmega161_fusedescr) }, { BITS(atmega161_lock), BITS(atmega161_lockdescr) } },		//44 ATmega161
+	{ { BITS(atmega163_fuse), BITS(atmega163_fusedescr) }, { BITS(atmega163_lock), BITS(atmega163_lockdescr) } },		//45 ATmega163
+	{ { BITS(atmega162_fuse), BITS(atmega162_fusedescr) }, { BITS(atmega162_lock), BITS(atmega162_lockdescr) } },		//46 ATmega162
+	{ { BITS(atmega169_fuse), BITS(atmega169_fusedescr) }, { BITS(atmega169_lock), BITS(atmega169_lockdescr) } },		//47 ATmega169
+	{ { BITS(atmega323_fuse), BITS(atmega323_fusedescr) }, { BITS(atmega323_lock), BITS(atmega323_lockdescr) } },		//48 ATmega323
+	{ { BITS(atmega32_fuse), BITS(atmega32_fusedescr) }, { BITS(atmega32_lock), BITS(atmega32_lockdescr) } },		//49 ATmega32
+	{ { NOBITS, NOBITS }, { BITS(pic12508_lock), BITS(pic12508_lockdescr) } },		//50 PIC12508, PIC12509, PIC12508A, PIC12509A, PIC12E518, PIC12E519
+	{ { NOBITS, NOBITS }, { BITS(pic12671_lock), BITS(pic12671_lockdescr) } },		//51 PIC12671, PIC12672, PIC12673, PIC12674
+	{ { NOBITS, NOBITS }, { BITS(pic1683_lock), BITS(pic1683_lockdescr) } },		//52 PIC1683, PIC1684, PIC1684A
+	{ { NOBITS, NOBITS }, { BITS(pic16870_lock), BITS(pic16870_lockdescr) } },		//53 PIC16870, PIC16871, PIC16872, PIC16873, PIC16874, PIC16876, PIC16877
+	{ { NOBITS, NOBITS }, { BITS(pic16873a_lock), BITS(pic16873a_lockdescr) } },		//54 PIC16873A, PIC16874A, PIC16876A, PIC16877A
+	{ { NOBITS, NOBITS }, { BITS(pic16627_lock), BITS(pic16627_lockdescr) } },		//55 PIC16627, PIC16628
+};
+
+static constexpr ChipBitsIndex chip_index[] =
+{
+	{ AT90S1200, 6 },
+	{ AT90S2313, 7 },
+	{ AT90S4414, 7 },
+	{ AT90S8515, 7 },
+	{ ATmega603, 36 },
+	{ ATmega103, 37 },
+	{ AT90S2323, 10 },
+	{ AT90S2343, 11 },
+	{ AT90S2333, 8 },
+	{ AT90S4433, 9 },
+	{ AT90S4434, 7 },
+	{ AT90S8534, 10 },
+	{ AT90S8535, 7 },
+	{ ATtiny22, 15 },
+	{ ATtiny12, 12 },
+	{ ATtiny13, 13 },
+	{ ATtiny15, 14 },
+	{ ATmega8515, 39 },
+	{ ATmega8535, 40 },
+	{ ATmega8, 38 },
+	{ ATmega161, 44 },
+	{ ATmega163, 45 },
+	{ ATmega16, 43 },
+	{ ATmega323, 48 },
+	{ ATmega32, 49 },
+	{ ATmega162, 46 },
+	{ ATmega169, 47 },
+	{ ATmega164, 28 },
+	{ ATmega324, 29 },
+	{ ATmega644, 30 },
+	{ ATmega64, 41 },
+	{ ATmega128, 42 },
+	{ ATmega48, 24 },
+	{ ATmega88, 25 },
+	{ ATmega168, 26 },
+	{ ATmega640, 31 },
+	{ ATmega1280, 32 },
+	{ ATmega1281, 33 },
+	{ ATmega2560, 34 },
+	{ ATmega2561, 35 },
+	{ ATmega328, 27 },
+	{ ATtiny26, 16 },
+	{ ATtiny2313, 17 },
+	{ ATtiny25, 18 },
+	{ ATtiny45, 19 },
+	{ ATtiny85, 20 },
+	{ ATtiny261, 21 },
+	{ ATtiny461, 22 },
+	{ ATtiny861, 23 },
+	{ AT90CAN32, 3 },
+	{ AT90CAN64, 4 },
+	{ AT90CAN128, 5 },
+	{ PIC1684, 52 },
+	{ PIC1683, 52 },
+	{ AT89S8252, 0 },
+	{ AT89S8253, 1 },
+	{ AT89S53, 0 },
+	{ AT89S52, 2 },
+	{ AT89S51, 2 },
+	{ PIC1684A, 52 },
+	{ PIC16870, 53 },
+	{ PIC16871, 53 },
+	{ PIC16872, 53 },
+	{ PIC16873, 53 },
+	{ PIC16874, 53 },
+	{ PIC16876, 53 },
+	{ PIC16877, 53 },
+	{ PIC16873A, 54 },
+	{ PIC16874A, 54 },
+	{ PIC16876A, 54 },
+	{ PIC16877A, 54 },
+	{ PIC16627, 55 },
+	{ PIC16628, 55 },
+	{ PIC12508, 50 },
+	{ PIC12509, 50 },
+	{ PIC12508A, 50 },
+	{ PIC12509A, 50 },
+	{ PIC12E518, 50 },
+	{ PIC12E519, 50 },
+	{ PIC12671, 51 },
+	{ PIC12672, 51 },
+	{ PIC12673, 51 },
+	{ PIC12674, 51 },
+};
+
+#define NO_OF_CHIPBITS  (int)(sizeof(chip_bits) / sizeof(chip_bits[0]))
+#define NO_OF_INDEX     (int)(sizeof(chip_index) / sizeof(chip_index[0]))
+
+static constexpr bool IndexSorted(const ChipBitsIndex *p, int n)
+{
+	return n < 2 || (IndexSorted(p, n / 2) && p[n / 2 - 1].type < p[n / 2].type && IndexSorted(p + n / 2, n - n / 2));
+}
+
+static constexpr bool IndexInRange(const ChipBitsIndex *p, int n)
+{
+	return (n == 1) ? (p->chip >= 0 && p->chip < NO_OF_CHIPBITS) : (n < 1 || (IndexInRange(p, n / 2) && IndexInRange(p + n / 2, n - n / 2)));
+}
+
+static_assert(IndexSorted(chip_index, NO_OF_INDEX), "chip_index[] must be sorted by type");
+static_assert(IndexInRange(chip_index, NO_OF_INDEX), "chip_index[] refers to a missing chip_bits[] entry");
+
+
+const ChipBitsDef *FindChipBits(long type)
+{
+	int lo = 0;
+	int hi = NO_OF_INDEX - 1;
+
+	while (lo <= hi)
+	{
+		int mid = (lo + hi) / 2;
+
+		if (chip_index[mid].type == type)
+		{
+			return &chip_bits[chip_index[mid].chip];
+		}
+		else if (chip_index[mid].type < type)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid - 1;
+		}
+	}
+
+	return NULL;
+}
+
+//bit descritti nella tabella
+uint32_t GetFuseFieldMask(const FuseFieldDef &f)
+{
+	uint32_t mask = 0;
+
+	for (int k = 0; k < f.n_bits; k++)
+	{
+		mask |= (uint32_t)1 << f.bits[k].bit;
+	}
+
+	return mask;
+}
+
+//Stesse regole del dialogo: niente bit oltre l'ultimo descritto e SPIEN
+// sempre programmato (altrimenti il chip non e` piu` accessibile via SPI)
+int ValidateFuseField(const FuseFieldDef &f, uint32_t value)
+{
+	int last = -1;
+
+	for (int k = 0; k < f.n_bits; k++)
+	{
+		if (f.bits[k].bit > last)
+		{
+			last = f.bits[k].bit;
+		}
+
+		if (strcmp(f.bits[k].ShortDescr, "SPIEN") == 0 && !(value & ((uint32_t)1 << f.bits[k].bit)))
+		{
+			return BADPARAM;
+		}
+	}
+
+	if (last >= 0 && last < 31 && (value >> (last + 1)) != 0)
+	{
+		return BADPARAM;
+	}
+
+	return OK;
+}
+
+//il nome del bit e` NAME seguito da cifre
+static bool MatchFieldName(const char *bitname, const char *name, int len)
+{
+	return strncmp(bitname, name, len) == 0 && isdigit((unsigned char)bitname[len]);
+}
+
+//Applica a value una o piu` assegnazioni "NAME=bbb" (stessa convenzione
+// delle mask description: bit a 1 --> bit impostato nel valore)
+int EncodeFuseField(const FuseFieldDef &f, const char *mask, uint32_t &value)
+{
+	uint32_t v = value;
+	const char *p = mask;
+
+	while (*p)
+	{
+		while (*p == ' ')
+		{
+			p++;
+		}
+
+		if (*p == '\0')
+		{
+			break;
+		}
+
+		const char *eq = strchr(p, '=');
+
+		if (eq == NULL || eq == p)
+		{
+			return BADPARAM;
+		}
+
+		int namelen = (int)(eq - p);
+		const char *bitstr = eq + 1;
+		int nbits = (int)strspn(bitstr, "01");
+
+		if (nbits == 0 || (bitstr[nbits] != ' ' && bitstr[nbits] != '\0'))
+		{
+			return BADPARAM;
+		}
+
+		//i bit del campo possono non essere contigui (FOSC0, FOSC1, ..., FOSC2)
+		// e ripetuti (CP0, CP1, CP0, CP1): il k-esimo trovato usa la cifra k
+		int nmatch = 0;
+
+		for (int k = 0; k < f.n_bits; k++)
+		{
+			if (MatchFieldName(f.bits[k].ShortDescr, p, namelen))
+			{
+				//il carattere piu` a destra e` il bit meno significativo
+				if (bitstr[nbits - 1 - (nmatch % nbits)] == '1')
+				{
+					v |= (uint32_t)1 << f.bits[k].bit;
+				}
+				else
+				{
+					v &= ~((uint32_t)1 << f.bits[k].bit);
+				}
+
+				nmatch++;
+			}
+		}
+
+		if (nmatch == 0 || (nmatch % nbits) != 0)
+		{
+			return BADPARAM;
+		}
+
+		p = bitstr + nbits;
+	}
+
+	value = v;
+
+	return OK;
+}
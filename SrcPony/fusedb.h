@@ -0,0 +1,75 @@
+//=========================================================================//
+//                                                                         //
+//  PonyProg - Serial Device Programmer                                    //
+//                                                                         //
+//  Copyright (C) 1997-2017   Claudio Lanconelli                           //
+//                                                                         //
+//  http://ponyprog.sourceforge.net                                        //
+//                                                                         //
+//-------------------------------------------------------------------------//
+//                                                                         //
+// This program is free software; you can redistribute it and/or           //
+// modify it under the terms of the GNU  General Public License            //
+// as published by the Free Software Foundation; either version2 of        //
+// the License, or (at your option) any later version.                     //
+//                                                                         //
+// This program is distributed in the hope that it will be useful,         //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of          //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU       //
+// General Public License for more details.                                //
+//                                                                         //
+// You should have received a copy of the GNU  General Public License      //
+// along with this program (see LICENSE);     if not, write to the         //
+// Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. //
+//                                                                         //
+//=========================================================================//
+
+#ifndef _FUSEDB_H
+#define _FUSEDB_H
+
+#include "types.h"
+
+// Descrizione dei fuse/lock bit, tabelle costanti usabili anche senza GUI
+
+struct FuseBitDef
+{
+	int  bit;
+	const char *ShortDescr;
+	const char *LongDescr;
+};
+
+// mask: "NAME=bbb" (piu` campi separati da spazio), il bit piu` a destra
+// corrisponde al primo bit NAMEn della tabella
+struct FuseMaskDef
+{
+	const char *mask;
+	const char *LongDescr;
+};
+
+struct FuseFieldDef
+{
+	const FuseBitDef *bits;
+	int  n_bits;
+	const FuseMaskDef *descr;
+	int  n_descr;
+};
+
+struct ChipBitsDef
+{
+	FuseFieldDef fuse;
+	FuseFieldDef lock;
+};
+
+struct ChipBitsIndex
+{
+	long type;
+	int  chip;
+};
+
+extern const ChipBitsDef *FindChipBits(long type);
+
+extern uint32_t GetFuseFieldMask(const FuseFieldDef &f);
+extern int ValidateFuseField(const FuseFieldDef &f, uint32_t value);
+extern int EncodeFuseField(const FuseFieldDef &f, const char *mask, uint32_t &value);
+
+#endif
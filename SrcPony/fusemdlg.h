@@ -35,13 +35,14 @@
 #include <QResizeEvent>
 
 #include "bitfield.h"
+#include "fusedb.h"
 #include "ui_fusedlg.h"
 
 #include "e2cmdw.h"
 
+// copia per i widget delle tabelle costanti di fusedb
 typedef struct
 {
-	QVector<long> type; // chip id's for same descriptions of chip bits
 	QVector<BitInfo> fuse;
 	QVector<MaskDescr> fuseDescr;
 	QVector<BitInfo> lock;
@@ -77,8 +78,6 @@ class fuseModalDialog : public QDialog, public cTranslator, public Ui::FuseDialo
 
 
   private:              //--------------------------------------- private
-	static QVector<ChipBits> eep_bits;
-
 	e2CmdWindow *cmdw;
 	e2AppWinInfo *awip;
 
@@ -92,9 +92,19 @@ enum BusType
 	PIC12B,
 	X2444B,
 	S2430B,
+	SPIFLASHB,
 	LAST_BT
 };
 
+//I2C bus timing profiles
+enum I2CTimingMode
+{
+	I2C_STANDARD = 0,       //Standard-mode, 100 KHz
+	I2C_FASTMODE,           //Fast-mode, 400 KHz
+	I2C_FASTMODEPLUS,       //Fast-mode Plus, 1 MHz
+	I2C_CUSTOM              //derived from the bus speed setting
+};
+
 
 #endif
 
@@ -35,6 +35,7 @@
 #include "e2cmdw.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
 
 
 #ifdef  __linux__
@@ -49,61 +50,159 @@
 #  endif
 #endif
 
-#define SCLTIMEOUT      900     // enable SCL check and timing (for slaves that hold down the SCL line to slow the transfer)
+#define SCLTIMEOUT      1000    // max clock stretching (usec) for slaves that hold down the SCL line to slow the transfer
 
-#define BUSYDELAY       100
-#define SDATIMEOUT      200
+//Minimum bus timing in nsec (I2C-bus specification, UM10204 table 10)
+static I2CTiming const i2c_profiles[] =
+{
+	// hd_sta, su_sta, su_sto, buf, low, high
+	{ 4000, 4700, 4000, 4700, 4700, 4000 },         // Standard-mode
+	{ 600, 600, 600, 1300, 1300, 600 },             // Fast-mode
+	{ 260, 260, 260, 500, 500, 260 }                // Fast-mode Plus
+};
 
-// Constructor
 I2CBus::I2CBus(BusInterface *ptr)
-	: BusIO(ptr)
+	: BusIO(ptr),
+	  bus_speed(NORMAL),
+	  timing_mode(I2C_STANDARD),
+	  io_latency(0),
+	  zero_delay(false)
 {
 	shot_delay = 0;
+	UpdateTiming();
 }
 
-// Destructor
 I2CBus::~I2CBus()
 {
 	Close();
 }
 
-int I2CBus::CheckBusy()
+void I2CBus::SetTimingMode(int mode)
+{
+	if (mode >= I2C_STANDARD && mode <= I2C_CUSTOM && mode != timing_mode)
+	{
+		timing_mode = mode;
+		UpdateTiming();
+	}
+}
+
+//Convert a minimum time in nsec to a WaitUsec() delay, discounting
+// the time already spent by the interface access that follows it
+static int PhaseUsec(int nsec, long latency)
 {
-	register int count;
+	long t = nsec - latency;
 
-	for (count = BUSYDELAY; count > 0 && isSCLSDAuno(); count--)
+	return (t > 0) ? (int)((t + 999) / 1000) : 0;
+}
+
+void I2CBus::UpdateTiming()
+{
+	if (bus_speed == TURBO)
 	{
-		WaitUsec(1);
+		// as fast as your PC can
+		memset(&phase, 0, sizeof(phase));
 	}
+	else if ((bus_speed == NORMAL || bus_speed == FAST) && timing_mode != I2C_CUSTOM)
+	{
+		// NORMAL always stay in Standard-mode, FAST use the fastest
+		// profile the device supports
+		int mode = (bus_speed == FAST) ? timing_mode : I2C_STANDARD;
+		I2CTiming const &t = i2c_profiles[mode];
+
+		phase.hd_sta = PhaseUsec(t.hd_sta, io_latency);
+		phase.su_sta = PhaseUsec(t.su_sta, io_latency);
+		phase.su_sto = PhaseUsec(t.su_sto, io_latency);
+		phase.buf = PhaseUsec(t.buf, io_latency);
+		phase.low = PhaseUsec(t.low, io_latency);
+		phase.high = PhaseUsec(t.high, io_latency);
+	}
+	else
+	{
+		// custom (slow) timing derived from the delay unit
+		phase.hd_sta = shot_delay;
+		phase.su_sta = shot_delay / 2;
+		phase.su_sto = shot_delay + 1;
+		phase.buf = shot_delay;
+		phase.low = shot_delay + 1;
+		phase.high = (shot_delay / 2) * 2;
+	}
+
+	zero_delay = (phase.low == 0 && phase.high == 0);
 
-	return (count ? IICERR_BUSBUSY : 0);
+	qDebug() << "I2CBus::UpdateTiming() mode = " << timing_mode << ", tLOW = " << phase.low << ", tHIGH = " << phase.high;
 }
 
-int I2CBus::SendStart()
+//Estimate the time spent by the interface for a single line access,
+// so the phase delays can be shortened by the same amount
+void I2CBus::MeasureLatency()
 {
-	register int err;
+	QElapsedTimer t;
+	int k;
 
-	setSCLSDA();
-#ifdef  SCLTIMEOUT
+	t.start();
+
+	for (k = 0; k < 32; k++)
+	{
+		getSCL();
+	}
+
+	io_latency = (long)(t.nsecsElapsed() / 32);
+
+	qDebug() << "I2CBus::MeasureLatency() = " << io_latency << " nsec";
+}
 
+//Wait for the slave to release SCL (clock stretching)
+int I2CBus::WaitSCLHigh()
+{
 	if (getSCL() == 0)
 	{
-		int k;
+		QElapsedTimer t;
+
+		t.start();
 
-		for (k = SCLTIMEOUT; getSCL() == 0 && k > 0; k--)
+		while (getSCL() == 0)
 		{
-			WaitUsec(1);
+			if (t.nsecsElapsed() > SCLTIMEOUT * 1000L)
+			{
+				return IICERR_SCLCONFLICT;
+			}
 		}
+	}
 
-		if (k == 0)
+	return 0;
+}
+
+//The bus must stay free (SCL and SDA high) at least for tBUF
+// (and tSU;STA in case of a repeated start) before a new START
+int I2CBus::CheckBusy()
+{
+	QElapsedTimer t;
+	long idle = (long)((phase.buf > phase.su_sta) ? phase.buf : phase.su_sta) * 1000;
+
+	t.start();
+
+	do
+	{
+		if (!isSCLSDAuno())
 		{
-			return IICERR_SCLCONFLICT;
+			return IICERR_BUSBUSY;
 		}
 	}
+	while (t.nsecsElapsed() < idle);
 
-#else
-	WaitUsec(shot_delay / 2);
-#endif
+	return 0;
+}
+
+int I2CBus::SendStart()
+{
+	register int err;
+
+	setSCLSDA();
+
+	if ((err = WaitSCLHigh()))
+	{
+		return err;
+	}
 
 	if ((err = CheckBusy()))
 	{
@@ -111,9 +210,8 @@ int I2CBus::SendStart()
 	}
 
 	clearSDA();
-	WaitUsec(shot_delay);   // tHD;STA = 4 usec
+	WaitUsec(phase.hd_sta);         // tHD;STA = 4 usec
 	clearSCL();
-	WaitUsec(shot_delay / 2);
 
 	return 0;
 }
@@ -121,34 +219,18 @@ int I2CBus::SendStart()
 int I2CBus::SendStop()
 {
 	clearSCL();
-	WaitUsec(shot_delay + 1);
 	clearSDA();
-	WaitUsec(shot_delay + 1);
+	WaitUsec(phase.low);
 	setSCL();
-#ifdef  SCLTIMEOUT
 
-	if (getSCL() == 0)
+	if (WaitSCLHigh())
 	{
-		int k;
-
-		for (k = SCLTIMEOUT; getSCL() == 0 && k > 0; k--)
-		{
-			WaitUsec(1);
-		}
-
-		if (k == 0)
-		{
-			//      qDebug() << "I2CBus::SendStop() *** SCL error";
-			return IICERR_SCLCONFLICT;
-		}
+		//      qDebug() << "I2CBus::SendStop() *** SCL error";
+		return IICERR_SCLCONFLICT;
 	}
 
-#else
-	WaitUsec(shot_delay / 2);
-#endif
-	WaitUsec(shot_delay + 1); // tSU;STOP = 4.7 usec
+	WaitUsec(phase.su_sto);         // tSU;STOP = 4.7 usec
 	setSDA();
-	WaitUsec(shot_delay / 2 + 1);
 
 	if (getSDA() == 0)
 	{
@@ -156,127 +238,72 @@ int I2CBus::SendStop()
 		return IICERR_SDACONFLICT;
 	}
 
-	//tBUF = 4.7 usec
-	WaitUsec(shot_delay);
+	//tBUF = 4.7 usec is granted by CheckBusy() before the next START
 
 	return 0;
 }
 
-int I2CBus::SendBitMast(int b)
+template <bool NoDelay>
+inline int I2CBus::SendBit(int b)
 {
 	bitSDA(b);
-	WaitUsec(shot_delay / 2 + 1);   // tSU;DAT = 250 nsec (tLOW / 2 = 2 usec)
+	PhaseDelay<NoDelay>(phase.low);         // tLOW, include tSU;DAT
 	setSCL();
 
 	/* Se SCL e` ancora 0 significa che uno Slave sta` rallentando
 	 * il trasferimento, attendi che SCL si rialzi */
-	if (getSCL() == 0)
+	if (WaitSCLHigh())
 	{
-#ifdef  SCLTIMEOUT
-		int k;
-
-		for (k = SCLTIMEOUT; getSCL() == 0 && k > 0; k--)
-		{
-			WaitUsec(1);
-		}
-
-		if (k == 0)
-		{
-			return IICERR_SCLCONFLICT;
-		}
-
-#endif
+		return IICERR_SCLCONFLICT;
 	}
 
-	WaitUsec(shot_delay / 2); // tHIGH / 2 = 2 usec
+	PhaseDelay<NoDelay>(phase.high);        // tHIGH
 
 	if (!getSDA() != !b)
 	{
 		return IICERR_SDACONFLICT;
 	}
 
-	WaitUsec(shot_delay / 2); // tHIGH / 2 = 2 usec
-	clearSCL();
-	WaitUsec(shot_delay / 2); // tHD;DATA = 300 nsec (tLOW / 2 = 2 usec)
+	clearSCL();             // tHD;DAT = 0 (the slave provides its own hold time)
 
 	return 0;
 }
 
-// returns a negative number if there's an error, 0 or 1 otherwise
-int I2CBus::RecBitMast()
+template <bool NoDelay>
+inline int I2CBus::RecBit()
 {
-	register uint8_t b;
+	int b;
 
 	setSDA();               // to receive data SDA must be high
-	WaitUsec(shot_delay / 2 + 1);   // tSU;DAT = 250 nsec (tLOW / 2 = 2 usec)
+	PhaseDelay<NoDelay>(phase.low);         // tLOW, the slave drive SDA within tVD;DAT
 	setSCL();
 
 	/* Se SCL e` ancora 0 significa che uno Slave sta` rallentando
 	 * il trasferimento, attendi che SCL si rialzi */
-	if (getSCL() == 0)
+	if (WaitSCLHigh())
 	{
-#ifdef  SCLTIMEOUT
-		int k;
-
-		for (k = SCLTIMEOUT; getSCL() == 0 && k > 0; k--)
-		{
-			WaitUsec(1);
-		}
-
-		if (k == 0)
-		{
-			return IICERR_SCLCONFLICT;
-		}
-
-#endif
+		return IICERR_SCLCONFLICT;
 	}
 
-	WaitUsec(shot_delay / 2); // tHIGH / 2 = 2 usec
+	PhaseDelay<NoDelay>(phase.high);        // tHIGH
 	b = getSDA();
-	WaitUsec(shot_delay / 2); // tHIGH / 2 = 2 usec
 	clearSCL();
-	WaitUsec(shot_delay / 2); // tHD;DATA = 300 nsec (tLOW / 2 = 2 usec)
 
 	return b;
 }
 
-// OK, ora ci alziamo di un livello: operiamo sul byte
-int I2CBus::SendByteMast(int by)
-{
-	int lrb, k;
-
-	for (k = 7; k >= 0; k--)
-		if ((lrb = SendBitMast(by & (1 << k))))
-		{
-			return lrb;
-		}
-
-	lrb = RecBitMast();     // acknowledge bit
-
-	if (lrb < 0)            // < 0 means that an error occured
-	{
-		return lrb;
-	}
-
-	if (lrb)
-	{
-		return IICERR_NOTACK;
-	}
-
-	return 0;
-}
-
-int I2CBus::SendByteMastLSB(int by)
+template <bool Lsb, bool NoDelay>
+int I2CBus::SendByte(int by)
 {
 	int lrb, k;
 
 	for (k = 0; k < 8; k++)
-		if ((lrb = SendBitMast(by & (1 << k))))
+		if ((lrb = SendBit<NoDelay>(by & (1 << (Lsb ? k : 7 - k)))))
 		{
 			return lrb;
 		}
 
-	lrb = RecBitMast();     // acknowledge bit
+	lrb = RecBit<NoDelay>();        // acknowledge bit
 
 	if (lrb < 0)            // < 0 means that an error occured
 	{
@@ -291,13 +318,14 @@ int I2CBus::SendByteMastLSB(int by)
 	return 0;
 }
 
-int I2CBus::RecByteMast(int ack)
+template <bool Lsb, bool NoDelay>
+int I2CBus::RecByte(int ack)
 {
 	int k, lrb, val = 0;
 
-	for (k = 7; k >= 0; k--)
+	for (k = 0; k < 8; k++)
 	{
-		lrb = RecBitMast();
+		lrb = RecBit<NoDelay>();
 
 		if (lrb < 0)
 		{
@@ -306,11 +334,11 @@ int I2CBus::RecByteMast(int ack)
 
 		if (lrb)
 		{
-			val |= 1 << k;
+			val |= 1 << (Lsb ? k : 7 - k);
 		}
 	}
 
-	if ((k = SendBitMast(ack)))     // send the ack
+	if ((k = SendBit<NoDelay>(ack)))        // send the ack
 	{
 		return k;
 	}
@@ -320,33 +348,34 @@ int I2CBus::RecByteMast(int ack)
 	return val;
 }
 
-int I2CBus::RecByteMastLSB(int ack)
+int I2CBus::SendBitMast(int b)
 {
-	int k, lrb, val = 0;
-
-	for (k = 0; k < 8; k++)
-	{
-		lrb = RecBitMast();
+	return zero_delay ? SendBit<true>(b) : SendBit<false>(b);
+}
 
-		if (lrb < 0)
-		{
-			return lrb;
-		}
+int I2CBus::RecBitMast()
+{
+	return zero_delay ? RecBit<true>() : RecBit<false>();
+}
 
-		if (lrb)
-		{
-			val |= 1 << k;
-		}
-	}
+int I2CBus::SendByteMast(int by)
+{
+	return zero_delay ? SendByte<false, true>(by) : SendByte<false, false>(by);
+}
 
-	if ((k = SendBitMast(ack)))     // send the ack
-	{
-		return k;
-	}
+int I2CBus::SendByteMastLSB(int by)
+{
+	return zero_delay ? SendByte<true, true>(by) : SendByte<true, false>(by);
+}
 
-	setSDA();       // release SDA line to the slave trasmitter
+int I2CBus::RecByteMast(int ack)
+{
+	return zero_delay ? RecByte<false, true>(ack) : RecByte<false, false>(ack);
+}
 
-	return val;
+int I2CBus::RecByteMastLSB(int ack)
+{
+	return zero_delay ? RecByte<true, true>(ack) : RecByte<true, false>(ack);
 }
 
 void I2CBus::SetDelay()
@@ -382,6 +411,8 @@ void I2CBus::SetDelay()
 	}
 
 	BusIO::SetDelay(n);
+	bus_speed = val;
+	UpdateTiming();
 
 	qDebug() << "I2CBus::SetDelay() = " << n;
 }
@@ -468,6 +499,22 @@ int I2CBus::Start(uint8_t slave)
 	return 0;
 }
 
+//ACK polling: solo START, indirizzo e STOP, nessun byte trasferito
+// e nessun errore registrato in err_no
+bool I2CBus::ProbeAck(uint8_t slave)
+{
+	bool ack = false;
+
+	if (SendStart() == 0)
+	{
+		ack = (SendByteMast(slave & 0xFE) == 0);
+	}
+
+	SendStop();
+
+	return ack;
+}
+
 /* se length e` zero, viene ricevuto un byte senza ack per cercare di
  * liberare il bus da uno slave che per qualche motivo e` ancora in
  * trasmissione. In questo caso data deve puntare ad un buffer di (almeno)
@@ -569,6 +616,89 @@ fineW:
 	return length - len;
 }
 
+/**
+ * Lettura sequenziale: imposta l'indirizzo interno una sola volta
+ * (index_len byte, MSB per primo) e poi legge tutti i dati nella stessa
+ * transazione. L'avanzamento e` riportato ad ogni punto percentuale di
+ * progress_total, indipendentemente dalla lunghezza della transazione.
+ * Se l'utente interrompe, l'ultimo byte viene letto senza ACK e
+ * ritorna un valore < length con err_no == 0.
+ */
+long I2CBus::ReadSequential(int slave, uint8_t const *index, int index_len, uint8_t *data, long length,
+							long progress_base, long progress_total, int lsb)
+{
+	int temp;
+	long len = 0;
+
+	qDebug() << "I2CBus::ReadSequential(" << slave << ", " << index_len << ", " << length << ") - IN";
+
+	err_no = 0;
+
+	if (length <= 0)
+	{
+		return 0;
+	}
+
+	if (progress_total <= 0)
+	{
+		progress_total = progress_base + length;
+	}
+
+	if (index_len > 0 && StartWrite(slave, index, index_len) != index_len)
+	{
+		return 0;
+	}
+
+	if ((temp = SendStart()))
+	{
+		err_no = temp;
+		return 0;
+	}
+
+	if ((temp = SendByteMast(slave | 1)) != 0)
+	{
+		err_no = (temp == IICERR_NOTACK) ? IICERR_NOADDRACK : temp;
+		last_addr = slave | 1;
+		return 0;
+	}
+
+	int last_pc = -1;
+	bool abort = false;
+
+	while (len < length && !abort)
+	{
+		int pc = (int)((progress_base + len) * 100 / progress_total);
+
+		if (pc != last_pc)
+		{
+			last_pc = pc;
+			abort = (ReadProgress(pc) != 0);
+		}
+
+		//l'ultimo byte (o quello dopo un abort) senza acknowledge
+		int nack = (abort || len == length - 1) ? 1 : 0;
+
+		temp = lsb ? RecByteMastLSB(nack) : RecByteMast(nack);
+
+		if (temp < 0)
+		{
+			err_no = temp;
+			break;
+		}
+
+		data[len++] = (uint8_t)temp;
+	}
+
+	if (err_no == 0 && Stop())
+	{
+		len = 0;
+	}
+
+	qDebug() << "I2CBus::ReadSequential() = " << len << ", err_no = " << err_no << " - OUT";
+
+	return len;
+}
+
 int I2CBus::Stop(void)
 {
 	qDebug() << "I2CBus::Stop() - IN";
@@ -584,6 +714,11 @@ int I2CBus::Reset(void)
 {
 	qDebug() << "I2CBus::Reset() - IN";
 
+	//ogni device imposta il suo profilo nel Probe(), chi non lo fa
+	// (2401) non deve ereditare quello dell'ultima 24xx
+	SetTimingMode(I2C_STANDARD);
+
+	MeasureLatency();
 	SetDelay();
 
 	uint8_t c;
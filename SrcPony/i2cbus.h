@@ -29,6 +29,18 @@
 
 #include "busio.h"
 
+//Bus timing of each protocol phase, in nsec for the profiles
+// and in usec once applied to the bus
+struct I2CTiming
+{
+	int hd_sta;     //tHD;STA hold time (repeated) START
+	int su_sta;     //tSU;STA set-up time for a repeated START
+	int su_sto;     //tSU;STO set-up time for STOP
+	int buf;        //tBUF bus free time between a STOP and a START
+	int low;        //tLOW low period of SCL
+	int high;       //tHIGH high period of SCL (tLOW include tSU;DAT)
+};
+
 class I2CBus : public BusIO
 {
   public:                //------------------------------- public
@@ -39,10 +51,13 @@ class I2CBus : public BusIO
 	long Write(int slave, uint8_t const *data, long length, int page_size = 0);
 
 	int Start(uint8_t slave);
+	bool ProbeAck(uint8_t slave);
 	int ReadByte(int ack, int lsb = 0);
 	int WriteByte(int by, int lsb = 0);
 	long StartRead(uint8_t slave, uint8_t *data, long length);
 	long StartWrite(uint8_t slave, uint8_t const *data, long length);
+	long ReadSequential(int slave, uint8_t const *index, int index_len, uint8_t *data, long length,
+						long progress_base = 0, long progress_total = 0, int lsb = 0);
 	int Stop();
 	int Reset();
 
@@ -51,9 +66,15 @@ class I2CBus : public BusIO
 	//      int Calibration(int slave = 0xA0);
 
 	void SetDelay();
+	void SetTimingMode(int mode);
+	int GetTimingMode() const
+	{
+		return timing_mode;
+	}
 
   protected:             //------------------------------- protected
 
+	int WaitSCLHigh();
 	int CheckBusy();
 	int SendStart();
 	int SendStop();
@@ -66,6 +87,34 @@ class I2CBus : public BusIO
 
   private:               //------------------------------- private
 
+	void UpdateTiming();
+	void MeasureLatency();
+
+	//Shift kernels specialized on bit order and zero delay (TURBO),
+	// selected once per byte by the SendByteMast/RecByteMast family
+	template <bool NoDelay>
+	int SendBit(int b);
+	template <bool NoDelay>
+	int RecBit();
+	template <bool Lsb, bool NoDelay>
+	int SendByte(int by);
+	template <bool Lsb, bool NoDelay>
+	int RecByte(int ack);
+
+	template <bool NoDelay>
+	void PhaseDelay(int usec)
+	{
+		if (!NoDelay && usec > 0)
+		{
+			WaitUsec(usec);
+		}
+	}
+
+	int bus_speed;          //speed setting (TURBO, FAST, NORMAL, ...)
+	int timing_mode;        //timing profile of the current device
+	long io_latency;        //nsec spent by a single interface access
+	I2CTiming phase;        //current per-phase delays (usec)
+	bool zero_delay;        //all the phase delays are zero
 
 	void setSCLSDA()
 	{
@@ -102,34 +102,33 @@ void MicroWireBus::SetDelay()
 }
 
 
-int MicroWireBus::SendDataBit(int b)
+template <bool NoDelay>
+inline void MicroWireBus::SendBit(int b)
 {
 	clearCLK();             //si assicura che SCK low
 	bitDI(b);
 
-	WaitUsec(shot_delay);
+	ShotDelay<NoDelay>();
 
 	setCLK();               //device latch data bit now!
 
-	WaitUsec(shot_delay);
+	ShotDelay<NoDelay>();
 
 	clearCLK();
-
-	return OK;
 }
 
-// ritorna un numero negativo se c'e` un errore, altrimenti 0 o 1
-int MicroWireBus::RecDataBit()
+template <bool NoDelay>
+inline int MicroWireBus::RecBit()
 {
-	register uint8_t b;
+	int b;
 
 	clearCLK();             //si assicura che SCK low
 
-	WaitUsec(shot_delay);
+	ShotDelay<NoDelay>();
 
 	setCLK();
 
-	WaitUsec(shot_delay);
+	ShotDelay<NoDelay>();
 
 	b = getDO();
 	clearCLK();
@@ -137,52 +136,43 @@ int MicroWireBus::RecDataBit()
 	return b;
 }
 
-int MicroWireBus::RecDataBitShort()
-{
-	clearCLK();             //si assicura che SCK low
-	WaitUsec(shot_delay);
-	return getDO();
-}
-
-// OK, ora ci alziamo di un livello: operiamo sul byte
-int MicroWireBus::SendDataWord(int wo, int wlen, int lsb)
+template <bool Lsb, bool NoDelay>
+void MicroWireBus::SendWord(int wo, int wlen)
 {
 	int k;
 
 	clearCLK();
 
-	if (lsb)
+	if (Lsb)
 	{
 		//Dal meno significativo al piu` significativo
 		for (k = 0; k < wlen; k++)
 		{
-			SendDataBit(wo & (1 << k));
+			SendBit<NoDelay>(wo & (1 << k));
 		}
 	}
 	else     //Dal piu` significativo al meno significativo
 	{
 		for (k = wlen - 1; k >= 0; k--)
 		{
-			SendDataBit(wo & (1 << k));
+			SendBit<NoDelay>(wo & (1 << k));
 		}
 	}
 
 	clearDI();
-
-	return OK;
 }
 
-//Standard Receive data word
-int MicroWireBus::RecDataWord(int wlen, int lsb)
+template <bool Lsb, bool NoDelay>
+int MicroWireBus::RecWord(int wlen)
 {
 	int k, val = 0;
 
 	clearCLK();
 
-	if (lsb)
+	if (Lsb)
 	{
 		for (k = 0; k < wlen; k++)
-			if (RecDataBit())
+			if (RecBit<NoDelay>())
 			{
 				val |= (1 << k);
 			}
@@ -190,7 +180,7 @@ int MicroWireBus::RecDataWord(int wlen, int lsb)
 	else
 	{
 		for (k = wlen - 1; k >= 0; k--)
-			if (RecDataBit())
+			if (RecBit<NoDelay>())
 			{
 				val |= (1 << k);
 			}
@@ -199,9 +189,58 @@ int MicroWireBus::RecDataWord(int wlen, int lsb)
 	return val;
 }
 
-//Receive Data word with the first clock pulse shortened.
-//  In case of the device doesn't leave a clock pulse to switch
-//  from DataOut to DataIn after the command
+int MicroWireBus::SendDataBit(int b)
+{
+	if (shot_delay == 0)
+	{
+		SendBit<true>(b);
+	}
+	else
+	{
+		SendBit<false>(b);
+	}
+
+	return OK;
+}
+
+int MicroWireBus::RecDataBit()
+{
+	return (shot_delay == 0) ? RecBit<true>() : RecBit<false>();
+}
+
+int MicroWireBus::RecDataBitShort()
+{
+	clearCLK();             //si assicura che SCK low
+	WaitUsec(shot_delay);
+	return getDO();
+}
+
+int MicroWireBus::SendDataWord(int wo, int wlen, int lsb)
+{
+	if (shot_delay == 0)
+	{
+		lsb ? SendWord<true, true>(wo, wlen) : SendWord<false, true>(wo, wlen);
+	}
+	else
+	{
+		lsb ? SendWord<true, false>(wo, wlen) : SendWord<false, false>(wo, wlen);
+	}
+
+	return OK;
+}
+
+int MicroWireBus::RecDataWord(int wlen, int lsb)
+{
+	if (shot_delay == 0)
+	{
+		return lsb ? RecWord<true, true>(wlen) : RecWord<false, true>(wlen);
+	}
+	else
+	{
+		return lsb ? RecWord<true, false>(wlen) : RecWord<false, false>(wlen);
+	}
+}
+
 int MicroWireBus::RecDataWordShort(int wlen, int lsb)
 {
 	int k, val = 0;
@@ -75,6 +75,17 @@ class MicroWireBus : public BusIO
 	int RecDataBit();
 	int RecDataBitShort();
 
+	//Shift kernels specialized on bit order and zero delay,
+	// selected once per word by SendDataWord()/RecDataWord()
+	template <bool NoDelay>
+	void SendBit(int b);
+	template <bool NoDelay>
+	int RecBit();
+	template <bool Lsb, bool NoDelay>
+	void SendWord(int wo, int wlen);
+	template <bool Lsb, bool NoDelay>
+	int RecWord(int wlen);
+
 	void bitDI(int b)
 	{
 		busI->SetDataOut(b);
@@ -69,8 +69,20 @@ int Pic125xx::SecurityRead(uint32_t &bits)
 	return rv;
 }
 
+//The config word is read first and written only if it changes.
+// Reading moves past it, so the bus is reset before the write.
 int Pic125xx::SecurityWrite(uint32_t bits)
 {
+	uint32_t cur = 0;
+	int read_rv = SecurityRead(cur);
+
+	GetBus()->Reset();
+
+	if (!ConfigChanged("Config", read_rv, cur, bits))
+	{
+		return OK;
+	}
+
 	uint16_t config = (uint16_t)bits;
 
 	CodeProtectAdjust(config, 0);
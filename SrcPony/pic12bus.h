@@ -51,6 +51,10 @@ class Pic12Bus : public BusIO
 
 	int CompareSingleWord(uint16_t data1, uint16_t data2, uint16_t mask);
 	int CompareMultiWord(uint8_t *data1, uint8_t *data2, long length, int split);
+	int CompareWordSize(int split) const
+	{
+		return split ? 1 : 2;
+	}
 
 	void SetDelay();
 
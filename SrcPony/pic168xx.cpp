@@ -123,15 +123,27 @@ int Pic168xx::QueryType(long &type)
 	return rv;
 }
 
+int Pic168xx::Identify(long &type, int &confidence)
+{
+	int rv = QueryType(type);
+
+	confidence = (rv == OK) ? 100 : 0;
+
+	return rv;
+}
+
 int Pic168xx::Probe(int probe_size)
 {
 	int rv = OK;
 	long type;
 
-	rv = QueryType(type);
+	rv = QueryTypeCached(type);
 //	int pritype = GetE2PPriType(type);
 	int subtype = GetE2PSubType(type);
 
+	//Program memory latch size (bytes) of the detected part, single word if not specified
+	SetProgPageSize(GetEEPTypeWPageSize(rv == OK ? type : GetAWInfo()->GetEEPId()), false);
+
 	if (probe_size)
 	{
 		if (rv == OK)
@@ -196,6 +208,8 @@ int Pic168xx::Write(int probe, int type)
 				}
 			}
 
+			qDebug() << "Pic168xx::Write() words programmed" << GetBus()->GetPagesWritten() << ", skipped" << GetBus()->GetPagesSkipped();
+
 			if (rv > 0 && (type & CONFIG_TYPE))
 			{
 				// write the config locations
@@ -43,6 +43,8 @@ class Pic168xx : public Pic16xx
 	int Write(int probe = 1, int type = ALL_TYPE);
 	//      int Verify(int type = ALL_TYPE);
 
+	int Identify(long &type, int &confidence);
+
   protected:    //--------------------------------------- protected
 
 	PicBus *GetBus()
@@ -29,6 +29,8 @@
 #include "errcode.h"
 #include "eeptypes.h"
 
+#include <QDebug>
+
 #include "e2awinfo.h"
 
 #define CONFIG_SIZE     ( 8 * sizeof(uint16_t) )
@@ -86,8 +88,17 @@ int Pic16xx::SecurityRead(uint32_t &bits)
 	return rv;
 }
 
+//The config word is read first and written only if it changes
 int Pic16xx::SecurityWrite(uint32_t bits)
 {
+	uint32_t cur = 0;
+	int read_rv = SecurityRead(cur);
+
+	if (!ConfigChanged("Config", read_rv, cur, bits))
+	{
+		return OK;
+	}
+
 	uint16_t config = (uint16_t)bits;
 
 	CodeProtectAdjust(config, 0);
@@ -173,6 +184,8 @@ int Pic16xx::Write(int probe, int type)
 				}
 			}
 
+			qDebug() << "Pic16xx::Write() words programmed" << GetBus()->GetPagesWritten() << ", skipped" << GetBus()->GetPagesSkipped();
+
 			if (rv > 0 && (type & CONFIG_TYPE))
 			{
 				// write the config locations
@@ -62,7 +62,8 @@ PicBus::PicBus(BusInterface *ptr)
 	  EraseProgMem(0x09),                     //Bulk Erase Program Memory *
 	  EraseDataMem(0x0b),                     //Bulk Erase Data Memory *
 	  BeginEraseProgCode(0x08),       //Begin Erase Programming Cycle *
-	  BeginProgOnlyCode(0x18)         //Begin Programming Only Cycle
+	  BeginProgOnlyCode(0x18),        //Begin Programming Only Cycle
+	  erased_mem(0)
 {
 }
 
@@ -109,40 +110,85 @@ void PicBus::SetDelay()
 	qDebug() << "PICBus::SetDelay() = " << n;
 }
 
-int PicBus::SendDataBit(int b)
+template <bool NoDelay>
+inline void PicBus::SendBit(int b)
 {
 	setCLK();               //set SCK high
 	bitDI(b);
 
-	WaitUsec(shot_delay);
+	ShotDelay<NoDelay>();
 
 	clearCLK();             //device latch data bit now!
 
-	WaitUsec(shot_delay);
-
-	return OK;
+	ShotDelay<NoDelay>();
 }
 
-// returns a negative number in case of error, 0 or 1 otherwise
-int PicBus::RecDataBit()
+template <bool NoDelay>
+inline int PicBus::RecBit()
 {
-	register uint8_t b;
+	int b;
 
 	setCLK();               //set SCK high (Pic output data now)
 
-	WaitUsec(shot_delay);
+	ShotDelay<NoDelay>();
 
 	b = getDO();    // sampling data on falling edge
 	clearCLK();
 
-	WaitUsec(shot_delay);
+	ShotDelay<NoDelay>();
 
 	return b;
 }
 
+template <int Len, bool NoDelay>
+void PicBus::SendWord(long wo)
+{
+	int k;
+
+	//transmit lsb first
+	for (k = 0; k < Len; k++)
+	{
+		SendBit<NoDelay>(wo & (1 << k));
+	}
+}
+
+template <int Len, bool NoDelay>
+long PicBus::RecWord()
+{
+	int k;
+	long val = 0;
+
+	//receive lsb first
+	for (k = 0; k < Len; k++)
+		if (RecBit<NoDelay>())
+		{
+			val |= 1 << k;
+		}
+
+	return val;
+}
+
+int PicBus::SendDataBit(int b)
+{
+	if (shot_delay == 0)
+	{
+		SendBit<true>(b);
+	}
+	else
+	{
+		SendBit<false>(b);
+	}
+
+	return OK;
+}
+
+int PicBus::RecDataBit()
+{
+	return (shot_delay == 0) ? RecBit<true>() : RecBit<false>();
+}
+
 #define CMD2CMD_DELAY   4000
 
-// OK, ora ci alziamo di un livello: operiamo sul byte
 int PicBus::SendDataWord(long wo, int wlen)
 {
 	int k;
@@ -150,12 +196,26 @@ int PicBus::SendDataWord(long wo, int wlen)
 	clearCLK();
 	clearDI();
 
-	WaitUsec(busI->GetCmd2CmdDelay());
+	if (busI->GetCmd2CmdDelay())
+	{
+		WaitUsec(busI->GetCmd2CmdDelay());
+	}
 
-	//transmit lsb first
-	for (k = 0; k < wlen; k++)
+	if (wlen == 6)
 	{
-		SendDataBit(wo & (1 << k));
+		(shot_delay == 0) ? SendWord<6, true>(wo) : SendWord<6, false>(wo);
+	}
+	else if (wlen == 16)
+	{
+		(shot_delay == 0) ? SendWord<16, true>(wo) : SendWord<16, false>(wo);
+	}
+	else
+	{
+		//transmit lsb first
+		for (k = 0; k < wlen; k++)
+		{
+			SendDataBit(wo & (1 << k));
+		}
 	}
 
 	setDI();
@@ -174,16 +234,26 @@ long PicBus::RecDataWord(int wlen)
 	clearCLK();
 	clearDI();
 
-	WaitUsec(busI->GetCmd2CmdDelay());
+	if (busI->GetCmd2CmdDelay())
+	{
+		WaitUsec(busI->GetCmd2CmdDelay());
+	}
 	setDI();
 	WaitUsec(2);
 
-	//receive lsb first
-	for (k = 0; k < wlen; k++)
-		if (RecDataBit())
-		{
-			val |= 1 << k;
-		}
+	if (wlen == 16)
+	{
+		val = (shot_delay == 0) ? RecWord<16, true>() : RecWord<16, false>();
+	}
+	else
+	{
+		//receive lsb first
+		for (k = 0; k < wlen; k++)
+			if (RecDataBit())
+			{
+				val |= 1 << k;
+			}
+	}
 
 	//      WaitUsec(shot_delay/4+1);
 
@@ -387,6 +457,8 @@ int PicBus::Erase(int type)
 
 		WaitMsec(40);
 		Reset();
+
+		erased_mem |= PROG_TYPE;
 	}
 
 	if (type & DATA_TYPE)
@@ -398,6 +470,8 @@ int PicBus::Erase(int type)
 
 		WaitMsec(40);
 		Reset();
+
+		erased_mem |= DATA_TYPE;
 	}
 
 	return OK;
@@ -476,22 +550,48 @@ long PicBus::Write(int addr, uint8_t const *data, long length, int page_size)
 		length >>= 1;        //contatore da byte a word
 	}
 
+	//Sparse write: after a bulk erase the words still at the erased
+	// value are stepped over instead of programmed
+	int mem = addr ? DATA_TYPE : PROG_TYPE;
+	bool sparse = (erased_mem & mem) != 0;
+	long last_used = sparse ? LastUsedWord(addr, data, length) : length - 1;
+
 	for (len = 0; len < length; len++)
 	{
 		uint16_t val;
 
+		if (len > last_used && ResetIsCheaper(length - len))
+		{
+			//Only erased words left: a Reset brings the address counter
+			// where the next operation expects it
+			Reset();
+			PageSkipped(length - len);
+			len = length;
+			break;
+		}
+
 		//Send command opcode
 		if (addr)
 		{
 			//Write Data code
-			SendCmdCode(LoadDataCode);
 			val  = (uint16_t)(*data++);
-			SendDataCode(val);
-			SendCmdCode(BeginEraseProgCode);
 
-			if (WaitReadyAfterWrite())
+			if (!sparse || CompareSingleWord(val, 0xffff, DataMask) != 0)
 			{
-				break;
+				SendCmdCode(LoadDataCode);
+				SendDataCode(val);
+				SendCmdCode(BeginEraseProgCode);
+
+				if (WaitReadyAfterWrite())
+				{
+					break;
+				}
+
+				PageWritten();
+			}
+			else
+			{
+				PageSkipped();
 			}
 
 			//Verify while programming (10/11/99)
@@ -503,22 +603,26 @@ long PicBus::Write(int addr, uint8_t const *data, long length, int page_size)
 		}
 		else
 		{
-			//Write Program code
-			SendCmdCode(LoadProgCode);
+			val = GetProgWord(data);
+			data += 2;
 
-#ifdef  _BIG_ENDIAN_
-			val  = (uint16_t)(*data++) << 8;
-			val |= (uint16_t)(*data++);
-#else
-			val  = (uint16_t)(*data++);
-			val |= (uint16_t)(*data++) << 8;
-#endif
-			SendProgCode(val);
-			SendCmdCode(BeginEraseProgCode);
+			if (!sparse || CompareSingleWord(val, 0xffff, ProgMask) != 0)
+			{
+				//Write Program code
+				SendCmdCode(LoadProgCode);
+				SendProgCode(val);
+				SendCmdCode(BeginEraseProgCode);
 
-			if (WaitReadyAfterWrite())
+				if (WaitReadyAfterWrite())
+				{
+					break;
+				}
+
+				PageWritten();
+			}
+			else
 			{
-				break;
+				PageSkipped();
 			}
 
 			//Verify while programming (10/11/99)
@@ -535,6 +639,9 @@ long PicBus::Write(int addr, uint8_t const *data, long length, int page_size)
 		}
 	}
 
+	//The memory is no longer blank
+	erased_mem &= ~mem;
+
 	WriteEnd();
 
 	if (addr == 0)
@@ -545,6 +652,49 @@ long PicBus::Write(int addr, uint8_t const *data, long length, int page_size)
 	return len;
 }
 
+uint16_t PicBus::GetProgWord(uint8_t const *p)
+{
+#ifdef  _BIG_ENDIAN_
+	return ((uint16_t)p[0] << 8) | (uint16_t)p[1];
+#else
+	return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+#endif
+}
+
+//Index of the last word (or data byte) not at the erased value, -1 if all blank
+long PicBus::LastUsedWord(int addr, uint8_t const *data, long length)
+{
+	long k;
+
+	for (k = length - 1; k >= 0; k--)
+	{
+		if (addr)
+		{
+			if (CompareSingleWord(data[k], 0xffff, DataMask) != 0)
+			{
+				break;
+			}
+		}
+		else
+		{
+			if (CompareSingleWord(GetProgWord(data + k * 2), 0xffff, ProgMask) != 0)
+			{
+				break;
+			}
+		}
+	}
+
+	return k;
+}
+
+//A Reset takes about 162 msec, stepping over a word one 6 bit command
+bool PicBus::ResetIsCheaper(long words)
+{
+	long inc_usec = 6 * (2 * shot_delay + 2) + busI->GetCmd2CmdDelay();
+
+	return words * inc_usec > 162000L;
+}
+
 int PicBus::CompareSingleWord(uint16_t data1, uint16_t data2, uint16_t mask)
 {
 	return (data1 & mask) != (data2 & mask);
@@ -50,6 +50,10 @@ class PicBus : public BusIO
 
 	int CompareSingleWord(uint16_t data1, uint16_t data2, uint16_t mask);
 	int CompareMultiWord(uint8_t *data1, uint8_t *data2, long length, int split);
+	int CompareWordSize(int split) const
+	{
+		return split ? 1 : 2;
+	}
 
 	void SetDelay();
 
@@ -59,6 +63,10 @@ class PicBus : public BusIO
 	long RecDataWord(int wlen = 16);
 	int WaitReadyAfterWrite(long timeout = 5000);
 
+	static uint16_t GetProgWord(uint8_t const *p);
+	long LastUsedWord(int addr, uint8_t const *data, long length);
+	bool ResetIsCheaper(long words);
+
 	int SendCmdCode(int opcode);
 	int SendProgCode(uint16_t data);
 	uint16_t RecvProgCode();
@@ -89,11 +97,24 @@ class PicBus : public BusIO
 	const uint8_t BeginEraseProgCode;
 	const uint8_t BeginProgOnlyCode;
 
+	int erased_mem;                 //memories (PROG_TYPE|DATA_TYPE) bulk erased and not yet written
+
   private:               //------------------------------- private
 
 	int SendDataBit(int b);
 	int RecDataBit();
 
+	//Shift kernels specialized on word length (6 bit commands,
+	// 16 bit data frames) and zero delay, selected once per word
+	template <bool NoDelay>
+	void SendBit(int b);
+	template <bool NoDelay>
+	int RecBit();
+	template <int Len, bool NoDelay>
+	void SendWord(long wo);
+	template <int Len, bool NoDelay>
+	long RecWord();
+
 	void bitDI(int b)
 	{
 		busI->SetInvDataOut(b);
@@ -71,63 +71,172 @@ long PicBusNew::Write(int addr, uint8_t const *data, long length, int page_size)
 		length >>= 1;        //contatore da byte a word
 	}
 
-	for (len = 0; len < length; len++)
-	{
-		uint16_t val;
+	//Programming-only cycles need an erased memory: the words still at
+	// the erased value are stepped over, the blank tail fast-forwarded
+	int mem = addr ? DATA_TYPE : PROG_TYPE;
+	long last_used = LastUsedWord(addr, data, length);
 
-		//Send command opcode
-		if (addr)
+	if (addr == 0 && page_size > 2)
+	{
+		//Multi-word programming latch: a whole row per programming cycle
+		len = WriteProgLatch(data, length, page_size >> 1, last_used);
+	}
+	else
+	{
+		for (len = 0; len < length; len++)
 		{
-			//Write Data code
-			val  = (uint16_t)(*data++);
+			uint16_t val;
 
-			if (CompareSingleWord(val, 0xffff, DataMask) != 0)
+			if (len > last_used && ResetIsCheaper(length - len))
 			{
-				SendCmdCode(LoadDataCode);
-				SendDataCode(val);
-				SendCmdCode(BeginProgOnlyCode);
+				Reset();
+				PageSkipped(length - len);
+				len = length;
+				break;
+			}
+
+			//Send command opcode
+			if (addr)
+			{
+				//Write Data code
+				val  = (uint16_t)(*data++);
+
+				if (CompareSingleWord(val, 0xffff, DataMask) != 0)
+				{
+					SendCmdCode(LoadDataCode);
+					SendDataCode(val);
+					SendCmdCode(BeginProgOnlyCode);
 
-				if (WaitReadyAfterWrite())
+					if (WaitReadyAfterWrite())
+					{
+						break;
+					}
+
+					PageWritten();
+				}
+				else
 				{
-					break;
+					PageSkipped();
 				}
+
+				//Verify while programming (10/11/99)
+				//      SendCmdCode(ReadDataCode);
+				//      if ( CompareSingleWord(val, RecvDataCode(), DataMask) )
+				//              break;
+
+				SendCmdCode(IncAddressCode);
 			}
+			else
+			{
+				val = GetProgWord(data);
+				data += 2;
 
-			//Verify while programming (10/11/99)
-			//      SendCmdCode(ReadDataCode);
-			//      if ( CompareSingleWord(val, RecvDataCode(), DataMask) )
-			//              break;
+				if (CompareSingleWord(val, 0xffff, ProgMask) != 0)
+				{
+					//Write Program code
+					SendCmdCode(LoadProgCode);
+					SendProgCode(val);
+					SendCmdCode(BeginProgOnlyCode);
 
-			SendCmdCode(IncAddressCode);
+					if (WaitReadyAfterWrite())
+					{
+						break;
+					}
+
+					PageWritten();
+				}
+				else
+				{
+					PageSkipped();
+				}
+
+				//Verify while programming (10/11/99)
+				//      SendCmdCode(ReadProgCode);
+				//      if ( CompareSingleWord(val, RecvProgCode(), ProgMask) )
+				//              break;
+
+				SendCmdCode(IncAddressCode);
+			}
+
+			if (WriteProgress(len * 100 / length))
+			{
+				break;
+			}
 		}
-		else
+	}
+
+	erased_mem &= ~mem;
+
+	WriteEnd();
+
+	if (addr == 0)
+	{
+		len <<= 1;        //contatore da word a byte
+	}
+
+	return len;
+}
+
+//Carica nei latch una riga di "latch" word (incrementando l'indirizzo
+// tra una e l'altra) e la scrive con un solo ciclo di programmazione.
+// Le righe vuote (0x3FFF) vengono solo saltate.
+long PicBusNew::WriteProgLatch(uint8_t const *data, long length, int latch, long last_used)
+{
+	long len;
+
+	for (len = 0; len < length; len += latch)
+	{
+		int n = (length - len < latch) ? (int)(length - len) : latch;
+		bool blank = true;
+		int k;
+
+		if (len > last_used && ResetIsCheaper(length - len))
 		{
-#ifdef  _BIG_ENDIAN_
-			val  = (uint16_t)(*data++) << 8;
-			val |= (uint16_t)(*data++);
-#else
-			val  = (uint16_t)(*data++);
-			val |= (uint16_t)(*data++) << 8;
-#endif
+			Reset();
+			PageSkipped(length - len);
+			len = length;
+			break;
+		}
+
+		for (k = 0; k < n && blank; k++)
+		{
+			if (CompareSingleWord(GetProgWord(data + (len + k) * 2), 0xffff, ProgMask) != 0)
+			{
+				blank = false;
+			}
+		}
 
-			if (CompareSingleWord(val, 0xffff, ProgMask) != 0)
+		if (blank)
+		{
+			for (k = 0; k < n; k++)
+			{
+				SendCmdCode(IncAddressCode);
+			}
+
+			PageSkipped(n);
+		}
+		else
+		{
+			for (k = 0; k < n; k++)
 			{
-				//Write Program code
 				SendCmdCode(LoadProgCode);
-				SendProgCode(val);
-				SendCmdCode(BeginProgOnlyCode);
+				SendProgCode(GetProgWord(data + (len + k) * 2));
 
-				if (WaitReadyAfterWrite())
+				//the programming cycle writes the row of the last loaded address
+				if (k < n - 1)
 				{
-					break;
+					SendCmdCode(IncAddressCode);
 				}
 			}
 
-			//Verify while programming (10/11/99)
-			//      SendCmdCode(ReadProgCode);
-			//      if ( CompareSingleWord(val, RecvProgCode(), ProgMask) )
-			//              break;
+			SendCmdCode(BeginProgOnlyCode);
+
+			if (WaitReadyAfterWrite())
+			{
+				break;
+			}
 
+			PageWritten(n);
 			SendCmdCode(IncAddressCode);
 		}
 
@@ -137,12 +246,5 @@ long PicBusNew::Write(int addr, uint8_t const *data, long length, int page_size)
 		}
 	}
 
-	WriteEnd();
-
-	if (addr == 0)
-	{
-		len <<= 1;        //contatore da word a byte
-	}
-
-	return len;
+	return (len < length) ? len : length;
 }
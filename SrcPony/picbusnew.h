@@ -45,6 +45,8 @@ class PicBusNew : public PicBus
 
   private:               //------------------------------- private
 
+	long WriteProgLatch(uint8_t const *data, long length, int latch, long last_used);
+
 };
 
 #endif
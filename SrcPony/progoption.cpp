@@ -46,7 +46,7 @@ progOptionDialog::progOptionDialog(QWidget *bw, long type, int &reload, int &ree
 	cmdw = static_cast<e2CmdWindow *>(bw);
 
 	chk = (QVector<QCheckBox *>() << idRELOAD << idREADFLASH << idREADEEP << idBYTESWAP <<
-		   idSETID << idREADOSCCAL << idERASE << idFLASH << idEEPROM << idLOCK);
+		   idSETID << idREADOSCCAL << idERASE << idFLASH << idEEPROM << idLOCK << idBLANKCHECK);
 
 	setTextWidgets();
 
@@ -74,7 +74,7 @@ progOptionDialog::~progOptionDialog()
 void progOptionDialog::setTextWidgets()
 {
 	QStringList txList = (QStringList() << translate(STR_MSGRELOAD) << translate(STR_MSGREADPROG) << translate(STR_MSGREADDATA) << translate(STR_MSGBYTESWAP) <<
-						  translate(STR_MSGSERNUM) << translate(STR_READOSCCALIB) << translate(STR_MSGERASE) << translate(STR_MSGWRITEPROG) << translate(STR_MSGWRITEDATA) << translate(STR_MSGWRITESEC));
+						  translate(STR_MSGSERNUM) << translate(STR_READOSCCALIB) << translate(STR_MSGERASE) << translate(STR_MSGWRITEPROG) << translate(STR_MSGWRITEDATA) << translate(STR_MSGWRITESEC) << translate(STR_MSGBLANKCHECK));
 
 	for (int i = 0; i < chk.size(); i++)
 	{
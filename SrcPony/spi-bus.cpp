@@ -99,57 +99,56 @@ void SPIBus::SetDelay()
 }
 
 
-int SPIBus::SendDataBit(int b)
+template <bool FallEdge, bool NoDelay>
+inline void SPIBus::SendBit(int b)
 {
-	if (fall_edge_sample)
+	if (FallEdge)
 	{
 		setSCK();               //be sure the SCK line is high
 		bitMOSI(b);
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 		clearSCK();             //slave latches data bit now!
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 	}
 	else
 	{
 		clearSCK();             //be sure the SCK line is low
 		bitMOSI(b);
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 		setSCK();               //slave latches data bit now!
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 		clearSCK();
 	}
-
-	return OK;
 }
 
-// ritorna un numero negativo se c'e` un errore, altrimenti 0 o 1
-int SPIBus::RecDataBit()
+template <bool FallEdge, bool NoDelay>
+inline int SPIBus::RecBit()
 {
-	register uint8_t b;
+	int b;
 
-	if (fall_edge_sample)
+	if (FallEdge)
 	{
 		setSCK();               //be sure the SCK line is high
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 		clearSCK();
 		b = getMISO();
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 	}
 	else
 	{
 		clearSCK();             //be sure the SCK line is low
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 		setSCK();
 		b = getMISO();
-		WaitUsec(shot_delay);
+		ShotDelay<NoDelay>();
 		clearSCK();
 	}
 
 	return b;
 }
 
-// OK, ora ci alziamo di un livello: operiamo sul byte
-int SPIBus::SendDataByte(int by)
+template <bool FallEdge, bool NoDelay>
+int SPIBus::SendByte(int by)
 {
 	int k;
 
@@ -158,7 +157,7 @@ int SPIBus::SendDataByte(int by)
 	//MSbit (7) sent first
 	for (k = 7; k >= 0; k--)
 	{
-		SendDataBit(by & (1 << k));
+		SendBit<FallEdge, NoDelay>(by & (1 << k));
 	}
 
 	setMOSI();
@@ -166,7 +165,8 @@ int SPIBus::SendDataByte(int by)
 	return OK;
 }
 
-int SPIBus::RecDataByte()
+template <bool FallEdge, bool NoDelay>
+int SPIBus::RecByte()
 {
 	int k, val = 0;
 
@@ -174,7 +174,7 @@ int SPIBus::RecDataByte()
 	clearSCK();
 
 	for (k = 7; k >= 0; k--)
-		if (RecDataBit())
+		if (RecBit<FallEdge, NoDelay>())
 		{
 			val |= 1 << k;
 		}
@@ -182,6 +182,58 @@ int SPIBus::RecDataByte()
 	return val;
 }
 
+int SPIBus::SendDataBit(int b)
+{
+	if (shot_delay == 0)
+	{
+		fall_edge_sample ? SendBit<true, true>(b) : SendBit<false, true>(b);
+	}
+	else
+	{
+		fall_edge_sample ? SendBit<true, false>(b) : SendBit<false, false>(b);
+	}
+
+	return OK;
+}
+
+// ritorna un numero negativo se c'e` un errore, altrimenti 0 o 1
+int SPIBus::RecDataBit()
+{
+	if (shot_delay == 0)
+	{
+		return fall_edge_sample ? RecBit<true, true>() : RecBit<false, true>();
+	}
+	else
+	{
+		return fall_edge_sample ? RecBit<true, false>() : RecBit<false, false>();
+	}
+}
+
+// OK, ora ci alziamo di un livello: operiamo sul byte
+int SPIBus::SendDataByte(int by)
+{
+	if (shot_delay == 0)
+	{
+		return fall_edge_sample ? SendByte<true, true>(by) : SendByte<false, true>(by);
+	}
+	else
+	{
+		return fall_edge_sample ? SendByte<true, false>(by) : SendByte<false, false>(by);
+	}
+}
+
+int SPIBus::RecDataByte()
+{
+	if (shot_delay == 0)
+	{
+		return fall_edge_sample ? RecByte<true, true>() : RecByte<false, true>();
+	}
+	else
+	{
+		return fall_edge_sample ? RecByte<true, false>() : RecByte<false, false>();
+	}
+}
+
 
 int SPIBus::Reset(void)
 {
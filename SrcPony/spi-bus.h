@@ -72,6 +72,17 @@ class SPIBus : public BusIO
 	int RecDataBit();
 
   private:
+	//Shift kernels specialized on clock phase and zero delay,
+	// selected once per byte by SendDataByte()/RecDataByte()
+	template <bool FallEdge, bool NoDelay>
+	void SendBit(int b);
+	template <bool FallEdge, bool NoDelay>
+	int RecBit();
+	template <bool FallEdge, bool NoDelay>
+	int SendByte(int by);
+	template <bool FallEdge, bool NoDelay>
+	int RecByte();
+
 	void bitMOSI(int b)
 	{
 		busI->SetDataOut(b);
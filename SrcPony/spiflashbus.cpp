@@ -0,0 +1,505 @@
+//=========================================================================//
+//                                                                         //
+//  PonyProg - Serial Device Programmer                                    //
+//                                                                         //
+//  Copyright (C) 1997-2017   Claudio Lanconelli                           //
+//                                                                         //
+//  http://ponyprog.sourceforge.net                                        //
+//                                                                         //
+//-------------------------------------------------------------------------//
+//                                                                         //
+// This program is free software; you can redistribute it and/or           //
+// modify it under the terms of the GNU  General Public License            //
+// as published by the Free Software Foundation; either version2 of        //
+// the License, or (at your option) any later version.                     //
+//                                                                         //
+// This program is distributed in the hope that it will be useful,         //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of          //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU       //
+// General Public License for more details.                                //
+//                                                                         //
+// You should have received a copy of the GNU  General Public License      //
+// along with this program (see LICENSE);     if not, write to the         //
+// Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. //
+//                                                                         //
+//=========================================================================//
+
+
+#include "types.h"
+#include "spiflashbus.h"
+#include "errcode.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+static int Percent(long n, long total)
+{
+	return (total > 0) ? (int)((long long)n * 100 / total) : 0;
+}
+
+static bool IsBlank(uint8_t const *data, long len)
+{
+	long k;
+
+	for (k = 0; k < len && data[k] == 0xFF; k++)
+		;
+
+	return k == len;
+}
+
+// Costruttore
+SpiFlashBus::SpiFlashBus(BusInterface *ptr)
+	: At250BigBus(ptr),
+	  FastRead(0x0B),
+	  ReadId(0x9F),
+	  SectorErase(0x20),
+	  BlockErase(0xD8),
+	  ChipErase(0xC7),
+	  Enter4Byte(0xB7),
+	  Exit4Byte(0xE9),
+	  ReleasePowerDown(0xAB),
+	  sector_size(4096),
+	  block_size(65536),
+	  t_sector(45),
+	  t_block(150),
+	  tmax_page(10),
+	  tmax_sector(500),
+	  tmax_block(2000),
+	  flash_size(0),
+	  erased(false)
+{
+	qDebug() << "SpiFlashBus::SpiFlashBus(" << (hex) << ptr << (dec) <<  ")";
+
+	SetAddressBytes(3);
+}
+
+//Alimentazione nuova: il contenuto non e` piu` noto
+int SpiFlashBus::Open(int port)
+{
+	erased = false;
+
+	return At250BigBus::Open(port);
+}
+
+int SpiFlashBus::Reset()
+{
+	qDebug() << "SpiFlashBus::Reset()";
+
+	At250Bus::Reset();
+
+	//esce dal deep power-down, se era in quello stato
+	SendDataByte(ReleasePowerDown);
+	EndCycle();
+	WaitUsec(50);
+
+	return OK;
+}
+
+//Costruttore, tipo di memoria e capacita` (1 << n byte), -1 se non risponde
+long SpiFlashBus::ReadJedecId()
+{
+	long id = 0;
+	int k;
+
+	SendDataByte(ReadId);
+
+	for (k = 0; k < 3; k++)
+	{
+		id = (id << 8) | (RecDataByte() & 0xFF);
+	}
+
+	EndCycle();
+
+	qDebug() << "SpiFlashBus::ReadJedecId() = " << (hex) << id << (dec);
+
+	int mfr = (int)(id >> 16);
+
+	return (mfr == 0x00 || mfr == 0xFF) ? -1 : id;
+}
+
+//Attende la fine del ciclo (WIP), timeout in msec
+bool SpiFlashBus::WaitReady(long timeout)
+{
+	QElapsedTimer timer;
+
+	timer.start();
+
+	while (ReadEEPStatus() & NotReadyFlag)
+	{
+		if (timer.hasExpired(timeout))
+		{
+			return false;
+		}
+
+		//le cancellazioni durano decine di msec, inutile interrogare di continuo
+		if (timeout > tmax_page)
+		{
+			WaitMsec(1);
+		}
+	}
+
+	return true;
+}
+
+//Toglie la protezione dei blocchi (BP0-BP3, TB, SEC) solo se impostata:
+// la scrittura dello status e` un ciclo non volatile
+bool SpiFlashBus::ClearProtection()
+{
+	if ((ReadEEPStatus() & 0x7C) == 0)
+	{
+		return true;
+	}
+
+	WriteEEPStatus(0);
+
+	return WaitReady(tmax_sector);
+}
+
+//Oltre 16MB servono 4 byte di indirizzo; all'uscita si torna a 3 byte
+// perche` il micro sulla scheda si aspetta il modo di default
+void SpiFlashBus::Enter4ByteMode()
+{
+	if (addr_bytes == 4)
+	{
+		SendDataByte(WriteEnable);
+		EndCycle();
+
+		SendDataByte(Enter4Byte);
+		EndCycle();
+	}
+}
+
+void SpiFlashBus::Exit4ByteMode()
+{
+	if (addr_bytes == 4)
+	{
+		SendDataByte(Exit4Byte);
+		EndCycle();
+	}
+}
+
+bool SpiFlashBus::EraseCmd(uint8_t cmd, long addr, long timeout)
+{
+	SendDataByte(WriteEnable);
+	EndCycle();
+
+	SendDataByte(cmd);
+
+	if (addr >= 0)
+	{
+		SendAddress(addr);
+	}
+
+	EndCycle();
+
+	return WaitReady(timeout);
+}
+
+void SpiFlashBus::ReadBlock(long addr, uint8_t *data, long length)
+{
+	long k;
+
+	SendDataByte(FastRead);
+	SendAddress(addr);
+	SendDataByte(0);                //dummy byte
+
+	for (k = 0; k < length; k++)
+	{
+		*data++ = (uint8_t)RecDataByte();
+	}
+
+	EndCycle();
+}
+
+long SpiFlashBus::Read(int addr, uint8_t *data, long length, int page_size)
+{
+	(void)page_size;
+
+	qDebug() << "SpiFlashBus::Read(" << (hex) << addr << ", " << data << ", " << (dec) << length << ")";
+
+	long len;
+
+	ReadStart();
+	Enter4ByteMode();
+
+	//un solo comando per tutta la memoria
+	SendDataByte(FastRead);
+	SendAddress(addr);
+	SendDataByte(0);                //dummy byte
+
+	for (len = 0; len < length; len++)
+	{
+		*data++ = (uint8_t)RecDataByte();
+
+		if ((len & 0xFF) == 0)
+		{
+			if (ReadProgress(Percent(len, length)))
+			{
+				break;
+			}
+		}
+	}
+
+	EndCycle();
+	Exit4ByteMode();
+
+	ReadEnd();
+
+	qDebug() << "SpiFlashBus::Read() = " << len;
+
+	return len;
+}
+
+//Cancella quanto serve per scrivere l'immagine. Un settore (4K) va
+// cancellato se qualche bit deve passare da 0 a 1: con la scrittura
+// differenziale lo si sa leggendolo, altrimenti il contenuto e` ignoto
+// e vanno cancellati tutti. In ogni blocco da 64K si cancella il blocco
+// intero quando costa meno dei singoli settori; se va cancellato tutto
+// il dispositivo si usa la cancellazione del chip.
+// addr deve essere allineato al settore.
+int SpiFlashBus::PlanErase(int addr, uint8_t const *data, long length, QVector<bool> &sect_erased, QVector<bool> &page_same)
+{
+	long nsect = sect_erased.size();
+	long per_sect = (page_same.size() + nsect - 1) / nsect;        //pagine per settore
+	QVector<bool> need(nsect, true);
+	long n_need = nsect;
+	long k, j;
+
+	if (GetDiffWrite())
+	{
+		uint8_t *dev = new uint8_t[sector_size];
+
+		n_need = 0;
+
+		for (k = 0; k < nsect; k++)
+		{
+			long base = k * sector_size;
+			long n = (length - base < sector_size) ? length - base : sector_size;
+			long page_size = sector_size / per_sect;
+
+			ReadBlock(addr + base, dev, n);
+
+			for (j = 0; j < n && (dev[j] & data[base + j]) == data[base + j]; j++)
+				;
+
+			need[k] = (j < n);
+
+			if (need[k])
+			{
+				n_need++;
+			}
+			else
+			{
+				//si possono ancora portare bit a 0: serve solo programmare le pagine diverse
+				for (j = 0; j * page_size < n; j++)
+				{
+					long off = j * page_size;
+					long pn = (n - off < page_size) ? n - off : page_size;
+
+					page_same[k * per_sect + j] = (memcmp(dev + off, data + base + off, pn) == 0);
+				}
+			}
+		}
+
+		delete[] dev;
+	}
+
+	qDebug() << "SpiFlashBus::PlanErase() sectors " << n_need << "/" << nsect;
+
+	if (n_need == 0)
+	{
+		return OK;
+	}
+
+	if (n_need == nsect && addr == 0 && length >= flash_size)
+	{
+		if (!EraseCmd(ChipErase, -1, (flash_size / block_size + 1) * tmax_block))
+		{
+			return E2P_TIMEOUT;
+		}
+
+		for (k = 0; k < nsect; k++)
+		{
+			sect_erased[k] = true;
+		}
+
+		return OK;
+	}
+
+	long per_block = block_size / sector_size;
+
+	for (k = 0; k < nsect; k += per_block)
+	{
+		long last = (k + per_block < nsect) ? k + per_block : nsect;
+		long cnt = 0;
+
+		for (j = k; j < last; j++)
+		{
+			if (need[j])
+			{
+				cnt++;
+			}
+		}
+
+		if (cnt == 0)
+		{
+			continue;
+		}
+
+		if (last - k == per_block && ((addr + k * sector_size) % block_size) == 0 && cnt * t_sector > t_block)
+		{
+			if (!EraseCmd(BlockErase, addr + k * sector_size, tmax_block))
+			{
+				return E2P_TIMEOUT;
+			}
+
+			for (j = k; j < last; j++)
+			{
+				sect_erased[j] = true;
+			}
+		}
+		else
+		{
+			for (j = k; j < last; j++)
+			{
+				if (need[j])
+				{
+					if (!EraseCmd(SectorErase, addr + j * sector_size, tmax_sector))
+					{
+						return E2P_TIMEOUT;
+					}
+
+					sect_erased[j] = true;
+				}
+			}
+		}
+	}
+
+	return OK;
+}
+
+//Le pagine vuote di un settore cancellato, e con la scrittura
+// differenziale quelle gia` uguali, non vengono programmate
+long SpiFlashBus::Write(int addr, uint8_t const *data, long length, int page_size)
+{
+	long len;
+	long count = 0;
+
+	if (page_size <= 0 || (sector_size % page_size) != 0)
+	{
+		page_size = 256;
+	}
+
+	long nsect = (length + sector_size - 1) / sector_size;
+	QVector<bool> sect_erased(nsect, erased);
+	QVector<bool> page_same(nsect * (sector_size / page_size), false);
+
+	WriteStart();
+
+	if (!ClearProtection())
+	{
+		return 0;        //Must return 0, because > 0 (and != length) means "Abort by user"
+	}
+
+	Enter4ByteMode();
+
+	if (!erased)
+	{
+		int rv = PlanErase(addr, data, length, sect_erased, page_same);
+
+		if (rv != OK)
+		{
+			Exit4ByteMode();
+			return rv;
+		}
+	}
+
+	//da qui in poi il chip non e` piu` cancellato, anche se la scrittura
+	// si interrompe: un nuovo tentativo deve ripianificare la cancellazione
+	erased = false;
+
+	for (len = 0; len < length; len += page_size, addr += page_size, data += page_size)
+	{
+		int n = (length - len < page_size) ? (int)(length - len) : page_size;
+		bool blank = IsBlank(data, n);
+		bool skip = sect_erased[len / sector_size] ? blank : page_same[len / page_size];
+
+		if (!blank)
+		{
+			SetLastProgrammedAddress(addr + n - 1);
+		}
+
+		if (skip)
+		{
+			PageSkipped();
+		}
+		else
+		{
+			int j;
+
+			PageWritten();
+
+			SendDataByte(WriteEnable);
+			EndCycle();
+
+			SendDataByte(WriteData);
+			SendAddress(addr);
+
+			for (j = 0; j < n; j++)
+			{
+				SendDataByte(data[j]);
+			}
+
+			EndCycle();
+
+			if (!WaitReady(tmax_page))
+			{
+				Exit4ByteMode();
+				return 0;
+			}
+
+			if (GetInlineVerify() && !PageMatches(addr, data, n))
+			{
+				Exit4ByteMode();
+				return VerifyFailed(addr);
+			}
+		}
+
+		if ((++count & 15) == 0)
+		{
+			if (WriteProgress(Percent(len, length)))
+			{
+				break;
+			}
+		}
+	}
+
+	Exit4ByteMode();
+
+	WriteEnd();
+
+	return (len > length) ? length : len;
+}
+
+int SpiFlashBus::Erase(int type)
+{
+	(void)type;
+
+	EraseStart();
+
+	if (!ClearProtection())
+	{
+		return E2P_TIMEOUT;
+	}
+
+	if (!EraseCmd(ChipErase, -1, (flash_size / block_size + 1) * tmax_block))
+	{
+		return E2P_TIMEOUT;
+	}
+
+	erased = true;
+
+	EraseEnd();
+
+	return OK;
+}
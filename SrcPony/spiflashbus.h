@@ -0,0 +1,98 @@
+//=========================================================================//
+//                                                                         //
+//  PonyProg - Serial Device Programmer                                    //
+//                                                                         //
+//  Copyright (C) 1997-2017   Claudio Lanconelli                           //
+//                                                                         //
+//  http://ponyprog.sourceforge.net                                        //
+//                                                                         //
+//-------------------------------------------------------------------------//
+//                                                                         //
+// This program is free software; you can redistribute it and/or           //
+// modify it under the terms of the GNU  General Public License            //
+// as published by the Free Software Foundation; either version2 of        //
+// the License, or (at your option) any later version.                     //
+//                                                                         //
+// This program is distributed in the hope that it will be useful,         //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of          //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU       //
+// General Public License for more details.                                //
+//                                                                         //
+// You should have received a copy of the GNU  General Public License      //
+// along with this program (see LICENSE);     if not, write to the         //
+// Free Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA. //
+//                                                                         //
+//=========================================================================//
+
+
+#ifndef _SPIFLASHBUS_H
+#define _SPIFLASHBUS_H
+
+#include "at250bus2.h"
+
+#include <QVector>
+
+//Flash NOR SPI (JEDEC): stessi comandi base delle 25xxx (WREN, RDSR,
+// WRSR, READ, PP) piu` identificazione, fast read e cancellazione
+class SpiFlashBus : public At250BigBus
+{
+  public:                //------------------------------- public
+	SpiFlashBus(BusInterface *ptr = 0);
+
+	int Open(int port);
+	int Reset();
+
+	long Read(int addr, uint8_t *data, long length, int page_size = 0);
+	long Write(int addr, uint8_t const *data, long length, int page_size = 0);
+	int Erase(int type = 0);
+
+	long ReadJedecId();
+
+	void SetFlashSize(long size)
+	{
+		flash_size = size;
+	}
+
+	//Contenuto gia` cancellato (Erase() o blank check) dall'accensione
+	void SetErased()
+	{
+		erased = true;
+	}
+
+  protected:             //------------------------------- protected
+
+	bool WaitReady(long timeout);
+	bool ClearProtection();
+	void Enter4ByteMode();
+	void Exit4ByteMode();
+	bool EraseCmd(uint8_t cmd, long addr, long timeout);
+	void ReadBlock(long addr, uint8_t *data, long length);
+	int PlanErase(int addr, uint8_t const *data, long length, QVector<bool> &sect_erased, QVector<bool> &page_same);
+
+	//Programming commands
+	const uint8_t FastRead;
+	const uint8_t ReadId;
+	const uint8_t SectorErase;
+	const uint8_t BlockErase;
+	const uint8_t ChipErase;
+	const uint8_t Enter4Byte;
+	const uint8_t Exit4Byte;
+	const uint8_t ReleasePowerDown;
+
+	//Tempi tipici (msec) per scegliere la cancellazione piu` rapida
+	// e massimi per la scadenza
+	const int sector_size;
+	const long block_size;
+	const int t_sector;
+	const int t_block;
+	const int tmax_page;
+	const int tmax_sector;
+	const int tmax_block;
+
+  private:               //------------------------------- private
+
+	long flash_size;
+	bool erased;            //tutta la flash e` cancellata
+};
+
+#endif
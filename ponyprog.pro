@@ -111,6 +111,7 @@ SOURCES  += SrcPony/aboutmdlg.cpp \
             SrcPony/main.cpp \
             SrcPony/e2app.cpp \
             SrcPony/at25xxx.cpp \
+            SrcPony/e25qxx.cpp \
             SrcPony/at93cbus.cpp \
             SrcPony/crc.cpp \
             SrcPony/e24xx-1.cpp \
@@ -142,10 +143,12 @@ SOURCES  += SrcPony/aboutmdlg.cpp \
             SrcPony/picbusnew.cpp \
             SrcPony/spi-bus.cpp \
             SrcPony/at250bus2.cpp \
+            SrcPony/spiflashbus.cpp \
             SrcPony/at89sxx.cpp \
             SrcPony/at93cxx.cpp \
             SrcPony/device.cpp \
             SrcPony/eeptypes.cpp \
+            SrcPony/fusedb.cpp \
             SrcPony/imbus.cpp \
             SrcPony/linuxsysfsint.cpp \
             SrcPony/pic12bus.cpp \
@@ -189,12 +192,14 @@ HEADERS  += SrcPony/e2app.h \
             SrcPony/microbus.h \
             SrcPony/aboutmdlg.h \
             SrcPony/at25xxx.h \
+            SrcPony/e25qxx.h \
             SrcPony/at93cbus.h \
             SrcPony/busio.h \
             SrcPony/dt006interf.h \
             SrcPony/e24xx.h \
             SrcPony/e2dlg.h \
             SrcPony/eeptypes.h \
+            SrcPony/fusedb.h \
             SrcPony/ispinterf.h \
             SrcPony/lpt_io_interf.h \
             SrcPony/pgminter.h \
@@ -214,6 +219,7 @@ HEADERS  += SrcPony/e2app.h \
             SrcPony/sdebus.h \
             SrcPony/types.h \
             SrcPony/at250bus2.h \
+            SrcPony/spiflashbus.h \
             SrcPony/at89sxx.h \
             SrcPony/at93cxx.h \
             SrcPony/crc.h \